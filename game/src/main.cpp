@@ -4,46 +4,51 @@
 #include <cstdlib>
 #include <iostream>
 #include <memory>
-#include <thread>
 
 // TODO: Factory for PlatformLayer
 #include "astro/core/platform/LayerConfig.hpp"
 #include "astro/core/platform/X11Layer.hpp"
+#include "astro/core/timing/FramePacer.hpp"
 
 #include "astro/graphics/graphics.hpp"
 #include "astro/math/math.hpp"
 
 using namespace astro::core::platform;
+using namespace astro::core::timing;
 using namespace astro::graphics;
 
 #define WIDTH 800
 #define HEIGHT 600
 #define COLOR_DEPTH 24
+#define TARGET_FPS 60
 
 
 int main(){
     std::cout << "AstroBurrito project\n";
 
-    const LayerConfig layerConfig = {
+    LayerConfig layerConfig = {
         "AstroBurrito",
         WIDTH,
         HEIGHT,
         COLOR_DEPTH,
         LayerEventType::EvtRequestAll
     };
+    layerConfig.asyncPresent = true; // Render the next frame while the previous one is presented
     const auto console = std::make_unique<X11Layer>();
     console->initialize(layerConfig);
 
     
-    Texture canvas(WIDTH, HEIGHT);
     Color clearColor(15, 15, 15);
-    clearTexture(canvas, clearColor);
+    
+    FramePacer pacer(TARGET_FPS);
+    auto lastStatsReport = std::chrono::steady_clock::now();
     
     LayerEvent event;
     bool shouldClose = false;
     while(!shouldClose){
         
         // Process layer event
+        const auto updateStart = FramePacer::Clock::now();
         console->processEvents(event);
         switch (event.type) {
             case (LayerEventType::EvtNone): { break; }
@@ -73,14 +78,33 @@ int main(){
             }
         }
         
+        pacer.addSectionTime(FrameSection::Update, FramePacer::Clock::now() - updateStart);
+        
         // Clear
-        clearTexture(canvas,  clearColor);
+        Texture& canvas = console->acquireCanvas();
+        {
+            auto renderSection = pacer.section(FrameSection::Render);
+            clearTexture(canvas,  clearColor);
+        }
         
         // Render
-        console->render(canvas);
+        {
+            auto presentSection = pacer.section(FrameSection::Present);
+            console->present(canvas);
+        }
+
+        // Wait for the remaining frame budget
+        pacer.endFrame();
 
-        // Wait
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        // Frame time report
+        const auto now = std::chrono::steady_clock::now();
+        if (now - lastStatsReport >= std::chrono::seconds(1)) {
+            const FrameStats stats = pacer.getStats();
+            std::cout << "[Game] frame min/avg/p99: " << stats.minFrameMs << "/" << stats.avgFrameMs << "/" << stats.p99FrameMs 
+                      << " ms | update " << stats.avgUpdateMs << " ms, render " << stats.avgRenderMs 
+                      << " ms, present " << stats.avgPresentMs << " ms\n";
+            lastStatsReport = now;
+        }
     }
     
     console->close();
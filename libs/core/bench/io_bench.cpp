@@ -0,0 +1,242 @@
+#include "astro/core/io/AssetLoader.hpp"
+#include "astro/core/io/FrameCapture.hpp"
+#include "astro/core/io/MeshFile.hpp"
+#include "astro/core/io/OBJFile.hpp"
+#include "astro/core/io/PPMImage.hpp"
+#include "astro/core/io/QOIImage.hpp"
+#include "astro/core/io/TGAImage.hpp"
+#include "astro/core/io/TextureFile.hpp"
+#include "astro_bench.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace astro::core::io;
+
+// ========================================================
+// --- OBJ LOADING ----------------------------------------
+// ========================================================
+/**
+ * @brief Writes a synthetic scan-like OBJ: a (n + 1) x (n + 1) grid of vertices with
+ * texcoords and normals and n x n quads (2 * n * n triangles after triangulation)
+ * @return std::string path of the file (temp directory, reused across runs)
+ */
+static std::string syntheticOBJ(int n) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / ("astro_bench_grid_" + std::to_string(n) + ".obj");
+    if (std::filesystem::exists(path)) return path.string();
+
+    std::ofstream fs(path, std::ios_base::trunc);
+    fs << "# Synthetic grid " << n << "x" << n << "\no grid\n";
+    for (int y = 0; y <= n; y++)
+        for (int x = 0; x <= n; x++)
+            fs << "v " << x * 0.01f << ' ' << 0.05f * ((x * 7 + y * 13) % 17) << ' ' << y * -0.01f << '\n';
+    for (int y = 0; y <= n; y++)
+        for (int x = 0; x <= n; x++)
+            fs << "vt " << float(x) / n << ' ' << float(y) / n << '\n';
+    for (int y = 0; y <= n; y++)
+        for (int x = 0; x <= n; x++)
+            fs << "vn " << 0.0f << ' ' << 0.707107f << ' ' << -0.707107f << '\n';
+    for (int y = 0; y < n; y++) {
+        for (int x = 0; x < n; x++) {
+            const int i0 = y * (n + 1) + x + 1, i1 = i0 + 1, i2 = i0 + n + 2, i3 = i0 + n + 1;
+            fs << "f " << i0 << '/' << i0 << '/' << i0 << ' ' << i1 << '/' << i1 << '/' << i1 << ' '
+               << i2 << '/' << i2 << '/' << i2 << ' ' << i3 << '/' << i3 << '/' << i3 << '\n';
+        }
+    }
+    return path.string();
+}
+
+// Time per triangle of a 200k triangle mesh (13 MB), single-threaded
+BENCHMARK(OBJLoadGrid) {
+    static const std::string path = syntheticOBJ(316);
+    size_t triangles = 0;
+    for (size_t i = 0; i < iterations; i++) {
+        OBJFile obj(path, 1);
+        triangles += obj.indices.size() / 3;
+        doNotOptimize(obj.vertices.data());
+    }
+    return triangles;
+}
+
+// Same mesh split in 8 chunks (compare with OBJLoadGrid for the scaling / the chunking overhead)
+BENCHMARK(OBJLoadGridChunked) {
+    static const std::string path = syntheticOBJ(316);
+    size_t triangles = 0;
+    for (size_t i = 0; i < iterations; i++) {
+        OBJFile obj(path, 8);
+        triangles += obj.indices.size() / 3;
+        doNotOptimize(obj.vertices.data());
+    }
+    return triangles;
+}
+
+// Same mesh through its .astromesh cache (built by the first call): map + header checks
+BENCHMARK(OBJLoadGridCached) {
+    static const std::string path = syntheticOBJ(316);
+    static const MeshFile warmup = MeshFile::loadOBJ(path);
+    size_t triangles = 0;
+    for (size_t i = 0; i < iterations; i++) {
+        const MeshFile mesh = MeshFile::loadOBJ(path);
+        triangles += mesh.indices().size() / 3;
+        doNotOptimize(mesh.vertices().data());
+    }
+    return triangles;
+}
+
+// ========================================================
+// --- TGA LOADING ----------------------------------------
+// ========================================================
+/**
+ * @brief Writes a 1024 x 1024 24-bit RLE TGA alternating runs of 6 pixels and raw packets
+ * of 4 pixels (about the packet mix of the diablo test textures)
+ * @return std::string path of the file (temp directory, reused across runs)
+ */
+static std::string syntheticTGA() {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "astro_bench_rle.tga";
+    if (std::filesystem::exists(path)) return path.string();
+
+    const int size = 1024;
+    std::vector<char> data(TGAImage::TGA_HEADER_SIZE, 0);
+    data[2] = TGAImage::TGA_TYPE_RLE_RGB;
+    data[12] = data[14] = 0; data[13] = data[15] = size >> 8;
+    data[16] = 24;
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x += 10) {
+            const int run = std::min(6, size - x), raw = std::min(4, size - x - run);
+            data.insert(data.end(), {char(128 + run - 1), char(x), char(y), char(x + y)});
+            if (raw <= 0) continue;
+            data.push_back(char(raw - 1));
+            for (int k = 0; k < raw; k++) data.insert(data.end(), {char(k), char(x), char(y)});
+        }
+    }
+    std::ofstream fs(path, std::ios_base::trunc | std::ios_base::binary);
+    fs.write(data.data(), static_cast<std::streamsize>(data.size()));
+    return path.string();
+}
+
+// Time per pixel, allocation of the texture included
+BENCHMARK(TGALoadRLE) {
+    static const std::string path = syntheticTGA();
+    size_t pixels = 0;
+    for (size_t i = 0; i < iterations; i++) {
+        const astro::graphics::Texture image = TGAImage::readImage(path);
+        pixels += image.data.size();
+        doNotOptimize(image.data.data());
+    }
+    return pixels;
+}
+
+// Four decodes of the same image as concurrent AssetLoader jobs (compare with TGALoadRLE)
+BENCHMARK(TGALoadAsync4) {
+    static const std::string path = syntheticTGA();
+    static AssetLoader loader;
+    size_t pixels = 0;
+    for (size_t i = 0; i < iterations; i++) {
+        AssetHandle<astro::graphics::Texture> images[4];
+        for (auto& image : images) image = loader.loadImage(path);
+        for (auto& image : images) pixels += image.get()->data.size();
+    }
+    return pixels;
+}
+
+// Same image through its .astrotex cache (built by the first call, with mips): map + one
+// read per page of level 0, so the page faults of a first use are counted
+BENCHMARK(TGALoadCached) {
+    static const std::string path = syntheticTGA();
+    static const TextureFile warmup = TextureFile::loadTGA(path);
+    size_t pixels = 0;
+    for (size_t i = 0; i < iterations; i++) {
+        const astro::graphics::Texture image = TextureFile::loadTGA(path).level(0);
+        unsigned sum = 0;
+        for (size_t p = 0; p < image.data.size(); p += 1024) sum += image.data[p].x;
+        pixels += image.data.size();
+        doNotOptimize(sum);
+    }
+    return pixels;
+}
+
+// ========================================================
+// --- PPM ------------------------------------------------
+// ========================================================
+static const std::string ppmPath = (std::filesystem::temp_directory_path() / "astro_bench_4k.ppm").string();
+
+// Time per pixel to write a 4K frame
+BENCHMARK(PPMWrite4K) {
+    static const astro::graphics::Texture frame(3840, 2160);
+    for (size_t i = 0; i < iterations; i++) PPMImage::writeImage(ppmPath, frame);
+    return iterations * frame.data.size();
+}
+
+// Time per pixel to read it back
+BENCHMARK(PPMRead4K) {
+    static const bool written = (PPMImage::writeImage(ppmPath, astro::graphics::Texture(3840, 2160)), true);
+    size_t pixels = 0;
+    for (size_t i = 0; i < iterations && written; i++) {
+        const astro::graphics::Texture frame = PPMImage::readImage(ppmPath);
+        pixels += frame.data.size();
+        doNotOptimize(frame.data.data());
+    }
+    return pixels;
+}
+
+// ========================================================
+// --- QOI ------------------------------------------------
+// ========================================================
+// Same image as TGALoadRLE (compare per-pixel times)
+static const std::string qoiPath = (std::filesystem::temp_directory_path() / "astro_bench_rle.qoi").string();
+
+// Time per pixel to encode it in memory
+BENCHMARK(QOIEncode) {
+    static const astro::graphics::Texture image = TGAImage::readImage(syntheticTGA());
+    size_t bytes = 0;
+    for (size_t i = 0; i < iterations; i++) bytes += QOIImage::encode(image).size();
+    doNotOptimize(bytes);
+    return iterations * image.data.size();
+}
+
+// Time per pixel to load it from a .qoi file, allocation of the texture included
+BENCHMARK(QOILoad) {
+    static const bool written = (QOIImage::writeImage(qoiPath, TGAImage::readImage(syntheticTGA())), true);
+    size_t pixels = 0;
+    for (size_t i = 0; i < iterations && written; i++) {
+        const astro::graphics::Texture image = QOIImage::readImage(qoiPath);
+        pixels += image.data.size();
+        doNotOptimize(image.data.data());
+    }
+    return pixels;
+}
+
+// ========================================================
+// --- Frame capture --------------------------------------
+// ========================================================
+// Time per pixel of the RGBA -> I420 conversion done by the writer thread
+BENCHMARK(CaptureI420Convert1080p) {
+    static const astro::graphics::Texture frame(1920, 1080);
+    static std::vector<uint8_t> planes(1920 * 1080 * 3 / 2);
+    for (size_t i = 0; i < iterations; i++) {
+        FrameCapture::rgbaToI420(frame.data.data(), 1920, 1080, planes.data(), planes.data() + 1920 * 1080,
+                                 planes.data() + 1920 * 1080 * 5 / 4);
+        doNotOptimize(planes.data());
+    }
+    return iterations * frame.data.size();
+}
+
+// Time per pixel to stream frames without dropping any (copy, conversion and write)
+BENCHMARK(CaptureStream1080p) {
+    static const astro::graphics::Texture frame(1920, 1080);
+    FrameCapture::Options options;
+    options.blockWhenFull = true;
+    FrameCapture capture;
+    capture.open((std::filesystem::temp_directory_path() / "astro_bench_capture.y4m").string(), 1920, 1080, options);
+    for (size_t i = 0; i < iterations; i++) capture.submit(frame);
+    capture.flush();
+    return iterations * frame.data.size();
+}
+
+int main(){
+    run_all_benchmarks();
+    return 0;
+}
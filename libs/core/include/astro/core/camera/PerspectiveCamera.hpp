@@ -28,14 +28,7 @@ public:
         m_target = target;
         m_up = up;
 
-        math::Vec3f zaxis = math::normalize(eye - target); // Forward
-        math::Vec3f xaxis = math::normalize(math::cross(up, zaxis)); // Right
-        math::Vec3f yaxis = math::cross(zaxis, xaxis); // Up
-
-        ViewMatrix = math::Mat4f::Identity();
-        ViewMatrix(0,0) = xaxis.x; ViewMatrix(0,1) = xaxis.y; ViewMatrix(0,2) = xaxis.z; ViewMatrix(0,3) = -math::dot(xaxis, eye);
-        ViewMatrix(1,0) = yaxis.x; ViewMatrix(1,1) = yaxis.y; ViewMatrix(1,2) = yaxis.z; ViewMatrix(1,3) = -math::dot(yaxis, eye);
-        ViewMatrix(2,0) = zaxis.x; ViewMatrix(2,1) = zaxis.y; ViewMatrix(2,2) = zaxis.z; ViewMatrix(2,3) = -math::dot(zaxis, eye);
+        ViewMatrix = math::lookAt(eye, target, up);
     }
     
 
@@ -57,18 +50,7 @@ private:
     void computeProjectionMatrix() {
         float aspect_ratio = static_cast<float>(width) / static_cast<float>(height);
         float fov_rad = fov_deg * (PI / 180.0f);
-        float f = 1.0f / std::tan(fov_rad / 2.0f);
-        
-        math::Mat4f proj(0);
-        proj(0,0) = f / aspect_ratio;
-        proj(1,1) = f;
-
-        proj(2,2) = (zfar + znear) / (znear - zfar);
-        proj(2,3) = (2.0f * zfar * znear) / (znear - zfar);
-
-        proj(3,2) = -1.0f;
-        
-        ProjectionMatrix = proj;
+        ProjectionMatrix = math::perspective(fov_rad, aspect_ratio, znear, zfar);
     }
 };
 
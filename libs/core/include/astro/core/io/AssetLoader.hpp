@@ -0,0 +1,239 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "astro/core/io/AssetRegistry.hpp"
+#include "astro/core/io/MeshFile.hpp"
+#include "astro/core/io/OBJFile.hpp"
+#include "astro/core/io/TextureFile.hpp"
+#include "astro/graphics/graphics.hpp"
+
+namespace astro {
+namespace core {
+namespace io {
+
+namespace detail {
+    /**
+     * @brief Result of a job shared by its handles: the value or the error, and the jobs
+     * waiting for it
+     */
+    template <typename T>
+    struct AssetState {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::atomic<bool> done = false;
+        std::shared_ptr<T> value;
+        std::exception_ptr error = nullptr;
+        std::vector<std::function<void()>> continuations;
+
+        void finish(std::shared_ptr<T> result, std::exception_ptr failure) {
+            std::vector<std::function<void()>> waiting;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                value = std::move(result);
+                error = failure;
+                done = true;
+                waiting.swap(continuations);
+            }
+            cv.notify_all();
+            for (auto& fn : waiting) fn();
+        }
+
+        // Runs 'fn' once the result is set (right away if it already is)
+        void onDone(std::function<void()> fn) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!done) {
+                    continuations.push_back(std::move(fn));
+                    return;
+                }
+            }
+            fn();
+        }
+    };
+}
+
+/**
+ * @brief Handle to an asset loaded by an AssetLoader. Copies share the same asset.
+ * ready()/tryGet() never block, so a render loop can draw a placeholder until the asset arrives.
+ */
+template <typename T>
+class AssetHandle {
+public:
+    AssetHandle() = default;
+
+    bool valid() const { return state != nullptr; }
+
+    /**
+     * @brief Whether the job finished (loaded or failed)
+     */
+    bool ready() const { return state && state->done; }
+
+    /**
+     * @brief Whether the job finished with an error
+     */
+    bool failed() const { return ready() && state->error != nullptr; }
+
+    /**
+     * @brief Waits for the asset (not from a job of the same loader: use AssetLoader::then)
+     * @throws the exception thrown by the job (or by the job it depends on)
+     */
+    std::shared_ptr<T> get() const {
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->cv.wait(lock, [this] { return state->done.load(); });
+        if (state->error) std::rethrow_exception(state->error);
+        return state->value;
+    }
+
+    /**
+     * @brief The asset if it is loaded, nullptr while loading or if the job failed
+     */
+    std::shared_ptr<T> tryGet() const {
+        if (!ready() || state->error) return nullptr;
+        return state->value;
+    }
+
+private:
+    friend class AssetLoader;
+    std::shared_ptr<detail::AssetState<T>> state;
+};
+
+/**
+ * @brief Loads assets on a pool of worker threads. Every job returns a handle immediately;
+ * then() chains dependent work, scheduled when its input is loaded (no worker waits for it).
+ * Errors are stored in the handle and propagate along chains.
+ * The destructor waits for every job, chained ones included.
+ *
+ * Example:
+ *   AssetLoader loader;
+ *   auto diffuse = loader.loadImage("diffuse.tga");
+ *   auto mesh = loader.loadOBJ("model.obj");
+ *   while (running) {
+ *       material.colorTexture = diffuse.tryGet(); // nullptr -> flat color until loaded
+ *       if (mesh.ready()) draw(*mesh.get());
+ *   }
+ */
+class AssetLoader {
+public:
+    /**
+     * @param threads worker threads (0: hardware concurrency)
+     * @param registry if set, the load*() jobs share their assets through it (it must outlive
+     * the loader)
+     */
+    explicit AssetLoader(unsigned threads = 0, AssetRegistry* registry = nullptr);
+    ~AssetLoader();
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    /**
+     * @brief Runs 'fn()' on a worker
+     * @return handle to its result
+     */
+    template <typename Fn>
+    auto run(Fn fn) -> AssetHandle<std::invoke_result_t<Fn&>> {
+        using T = std::invoke_result_t<Fn&>;
+        return runShared<T>([fn = std::move(fn)]() mutable { return std::make_shared<T>(fn()); });
+    }
+
+    /**
+     * @brief Runs 'fn()' returning a std::shared_ptr<T> on a worker (the handle shares that
+     * instance, e.g. one owned by an AssetRegistry)
+     */
+    template <typename T, typename Fn>
+    AssetHandle<T> runShared(Fn fn) {
+        AssetHandle<T> output;
+        output.state = std::make_shared<detail::AssetState<T>>();
+        pending++;
+        enqueue([state = output.state, fn = std::move(fn)]() mutable {
+            try {
+                state->finish(fn(), nullptr);
+            } catch (...) {
+                state->finish(nullptr, std::current_exception());
+            }
+        });
+        return output;
+    }
+
+    /**
+     * @brief Runs 'fn(const T&)' on a worker once 'input' is loaded. If 'input' fails, 'fn'
+     * is skipped and the returned handle holds the same error.
+     * @return handle to the result of 'fn'
+     */
+    template <typename T, typename Fn>
+    auto then(const AssetHandle<T>& input, Fn fn) -> AssetHandle<std::invoke_result_t<Fn&, const T&>> {
+        using U = std::invoke_result_t<Fn&, const T&>;
+        AssetHandle<U> output;
+        output.state = std::make_shared<detail::AssetState<U>>();
+        pending++;
+        input.state->onDone([this, in = input.state, out = output.state, fn = std::move(fn)]() mutable {
+            enqueue([in, out, fn = std::move(fn)]() mutable {
+                if (in->error) {
+                    out->finish(nullptr, in->error);
+                    return;
+                }
+                try {
+                    out->finish(std::make_shared<U>(fn(std::as_const(*in->value))), nullptr);
+                } catch (...) {
+                    out->finish(nullptr, std::current_exception());
+                }
+            });
+        });
+        return output;
+    }
+
+    /**
+     * @brief Decodes a TGA or QOI image (see AssetRegistry::readImage)
+     */
+    AssetHandle<graphics::Texture> loadImage(const std::string& path);
+
+    /**
+     * @brief Loads a TGA through its .astrotex cache, mip chain included (see TextureFile::loadTGA)
+     */
+    AssetHandle<TextureFile> loadTexture(const std::string& path, bool mips = true);
+
+    /**
+     * @brief Parses an OBJ, tangents included (see OBJFile::loadFromFile)
+     * @param threads parser threads for this file (1 keeps the job on its worker)
+     */
+    AssetHandle<OBJFile> loadOBJ(const std::string& path, unsigned threads = 1);
+
+    /**
+     * @brief Loads an OBJ through its .astromesh cache (see MeshFile::loadOBJ)
+     */
+    AssetHandle<MeshFile> loadMesh(const std::string& path, unsigned threads = 1);
+
+    /**
+     * @brief Blocks until every submitted job (and chained job) has finished
+     */
+    void wait();
+
+    size_t threadCount() const { return workers.size(); }
+
+private:
+    AssetRegistry* registry;
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> jobs;
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool running = true;
+    std::atomic<size_t> pending = 0; // Jobs submitted or chained and not finished yet
+
+    void enqueue(std::function<void()> job);
+    void workerLoop();
+};
+
+}
+}
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+
+#include "astro/core/io/MappedFile.hpp"
+#include "astro/core/io/MeshFile.hpp"
+#include "astro/core/io/OBJFile.hpp"
+#include "astro/core/io/TextureFile.hpp"
+#include "astro/graphics/graphics.hpp"
+
+namespace astro {
+namespace core {
+namespace io {
+
+/**
+ * @brief Shares loaded assets: every request for the same file returns the same instance.
+ * Assets are found by type and path (reloaded if the file changed since). With shareContent
+ * they are also found by type and content hash, so copies of a file under different paths
+ * share one instance too.
+ *
+ * The registry only keeps weak references: an asset is freed as soon as its last
+ * shared_ptr is released, and loaded again by the next request. Callers that want to keep
+ * an asset around without pinning it can hold a std::weak_ptr.
+ *
+ * Example (one texture instance for any number of materials):
+ *   AssetRegistry registry;
+ *   material.colorTexture = registry.texture("diffuse.tga");
+ */
+class AssetRegistry {
+public:
+    struct Stats {
+        size_t loads;       // Assets loaded from their file
+        size_t pathHits;    // Requests served by a live asset of the same path
+        size_t contentHits; // Requests served by a live asset with the same content
+    };
+
+    /**
+     * @param shareContent also share assets by content. A path miss then hashes the whole file
+     * before loading it: the first load of every file reads it twice (the second read usually
+     * comes from the page cache), so only enable it when copies of the same file are expected.
+     */
+    explicit AssetRegistry(bool shareContent = false) : shareContent(shareContent) {}
+
+    /**
+     * @brief Live asset of type T for 'path', or the result of 'load(path)' registered for
+     * the next requests. 'load' may return a T or a std::shared_ptr<T>.
+     * Thread-safe; loads run without the lock (two threads loading the same new file both
+     * load it, and the second one gets the instance registered first). An asset whose file
+     * changed while it was loaded is returned but not registered by content, and is loaded
+     * again by the next request.
+     * @throws std::runtime_error if the file does not exist, or the exception thrown by 'load'
+     */
+    template <typename T, typename Load>
+    std::shared_ptr<T> get(const std::string& path, Load load) {
+        const std::type_index type(typeid(T));
+        const std::string key = canonicalPath(path);
+        FileStamp stamp{};
+        if (std::shared_ptr<void> found = lookup(type, key, stamp)) return std::static_pointer_cast<T>(found);
+
+        std::shared_ptr<T> asset;
+        if constexpr (std::is_same_v<std::invoke_result_t<Load&, const std::string&>, std::shared_ptr<T>>) {
+            asset = load(key);
+        } else {
+            asset = std::make_shared<T>(load(key));
+        }
+        return std::static_pointer_cast<T>(insert(type, key, stamp, std::move(asset)));
+    }
+
+    /**
+     * @brief Live asset of type T for 'path' if there is one (never loads)
+     */
+    template <typename T>
+    std::shared_ptr<T> find(const std::string& path) {
+        return std::static_pointer_cast<T>(findLive(std::type_index(typeid(T)), canonicalPath(path)));
+    }
+
+    /**
+     * @brief Image decoded by readImage()
+     */
+    std::shared_ptr<graphics::Texture> texture(const std::string& path);
+
+    /**
+     * @brief TGA through its .astrotex cache, with mips (see TextureFile::loadTGA)
+     */
+    std::shared_ptr<TextureFile> textureFile(const std::string& path);
+
+    /**
+     * @brief Parsed OBJ (see OBJFile::loadFromFile)
+     */
+    std::shared_ptr<OBJFile> obj(const std::string& path, unsigned threads = 0);
+
+    /**
+     * @brief OBJ through its .astromesh cache (see MeshFile::loadOBJ)
+     */
+    std::shared_ptr<MeshFile> mesh(const std::string& path, unsigned threads = 0);
+
+    /**
+     * @brief Number of registered assets still alive
+     */
+    size_t liveCount();
+
+    /**
+     * @brief Forgets the assets that have been freed (their entries are otherwise dropped
+     * when their path is requested again)
+     */
+    void purge();
+
+    Stats stats();
+
+    /**
+     * @brief Decodes an image by its extension: QOI for '.qoi', TGA otherwise
+     * @throws std::runtime_error if the image can not be loaded
+     */
+    static graphics::Texture readImage(const std::string& path);
+
+private:
+    using PathKey = std::pair<std::type_index, std::string>;
+    using ContentKey = std::tuple<std::type_index, uint64_t, uint64_t>; // Type, size, hash
+
+    struct Entry {
+        FileStamp stamp;
+        std::weak_ptr<void> asset;
+    };
+
+    const bool shareContent;
+    std::mutex mutex;
+    std::map<PathKey, Entry> byPath;
+    std::map<ContentKey, std::weak_ptr<void>> byContent;
+    Stats counters{};
+
+    static std::string canonicalPath(const std::string& path);
+    // Live asset for the path (same stamp) or the content; fills 'stamp' with the file stamp
+    // (hashed only with shareContent)
+    std::shared_ptr<void> lookup(std::type_index type, const std::string& key, FileStamp& stamp);
+    // Registers a loaded asset, or returns the one registered meanwhile for the same file
+    std::shared_ptr<void> insert(std::type_index type, const std::string& key, const FileStamp& stamp, std::shared_ptr<void> asset);
+    std::shared_ptr<void> findLive(std::type_index type, const std::string& key);
+};
+
+}
+}
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "astro/graphics/graphics.hpp"
+
+namespace astro {
+namespace core {
+namespace io {
+
+/**
+ * @brief Records frames to a video file on a background thread.
+ * submit() copies the frame into a free buffer of a bounded ring and returns; the writer thread
+ * converts and writes the queued buffers. When every buffer is in use the frame is dropped
+ * (counted in droppedFrames()) or, with Options::blockWhenFull, submit() waits for a buffer.
+ *
+ * Formats:
+ *  - Y4M: YUV4MPEG2 stream, 4:2:0 (BT.601 limited range), playable by ffmpeg/mpv
+ *  - RawRGB: headerless packed RGB24 frames (ffmpeg -f rawvideo -pix_fmt rgb24 -s WxH)
+ */
+class FrameCapture {
+public:
+    enum class Format { Y4M, RawRGB };
+
+    struct Options {
+        Format format = Format::Y4M;
+        int ringLength = 4;         // Frame buffers shared with the writer thread (at least 1)
+        bool blockWhenFull = false; // Wait for a free buffer instead of dropping the frame
+        int fps = 60;               // Frame rate written in the Y4M header
+    };
+
+    FrameCapture() = default;
+    ~FrameCapture() { close(); }
+    FrameCapture(const FrameCapture&) = delete;
+    FrameCapture& operator=(const FrameCapture&) = delete;
+
+    /**
+     * @brief Creates the file, writes the stream header and starts the writer thread
+     * @throws std::runtime_error if the file can not be created or the size is invalid
+     */
+    void open(const std::string& path, int width, int height, const Options& options);
+    void open(const std::string& path, int width, int height) { open(path, width, height, Options()); }
+
+    /**
+     * @brief Queues a copy of the frame
+     * @return false if the frame was dropped because the ring was full
+     * @throws std::runtime_error if the capture is not open, the frame size differs from the
+     * capture size or the writer failed
+     */
+    bool submit(const graphics::Texture& frame);
+
+    /**
+     * @brief Blocks until every queued frame has been written
+     * @throws std::runtime_error if the writer failed
+     */
+    void flush();
+
+    /**
+     * @brief Writes the queued frames, stops the writer thread and closes the file
+     */
+    void close();
+
+    /**
+     * @brief Whether open() was called and close() was not (stays true after a writer error,
+     * reported by the next submit() or flush())
+     */
+    bool isOpen() const { return opened; }
+    size_t submittedFrames();
+    size_t writtenFrames();
+    size_t droppedFrames();
+
+    /**
+     * @brief Converts RGBA rows to planar 4:2:0 (BT.601 limited range). Pairs of rows share the
+     * chroma rows, odd sizes repeat the last column/row. Planes are tightly packed.
+     * @param yPlane width * height bytes
+     * @param uPlane, vPlane ((width + 1) / 2) * ((height + 1) / 2) bytes each
+     */
+    static void rgbaToI420(const graphics::Color* pixels, int width, int height, uint8_t* yPlane, uint8_t* uPlane, uint8_t* vPlane);
+
+private:
+    Options options;
+    int width = 0;
+    int height = 0;
+    std::ofstream file;
+
+    std::vector<std::unique_ptr<std::vector<graphics::Color>>> buffers; // Stable addresses
+    std::deque<std::vector<graphics::Color>*> freeBuffers;
+    std::deque<std::vector<graphics::Color>*> readyBuffers;
+    bool writing = false;
+    std::vector<uint8_t> encoded; // Writer thread only
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::thread writer;
+    std::exception_ptr writerError = nullptr;
+    bool running = false; // Writer thread state (cleared by the writer on error)
+    bool opened = false;  // Only changed by open()/close()
+    size_t submitted = 0, written = 0, dropped = 0;
+
+    void writerLoop();
+    void writeFrame(const std::vector<graphics::Color>& frame);
+    void rethrowWriterError();
+};
+
+}
+}
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace astro {
+namespace core {
+namespace io {
+
+/**
+ * @brief Identity of a file, used to invalidate caches built from it
+ */
+struct FileStamp {
+    uint64_t size;
+    int64_t mtime;   // Modification time (file clock ticks)
+    uint64_t hash;   // Hash of the whole content (0 if not computed)
+
+    /**
+     * @brief Size and modification time, without reading the file
+     * @throws std::runtime_error if the file does not exist
+     */
+    static FileStamp quick(const std::string& filepath);
+
+    /**
+     * @brief Size, modification time and content hash
+     * @throws std::runtime_error if the file can not be read
+     */
+    static FileStamp of(const std::string& filepath);
+
+    /**
+     * @brief Checks a cache file built from 'sourcePath', which stores the stamp of its source
+     * ('cached') at 'stampOffset'. The cache is valid if the size and mtime match, or if the
+     * size and content hash match (touch, checkout): then the new mtime is written back to the
+     * cache so the next check skips the hash.
+     * @param source quick stamp of the source; gets its hash when it was computed
+     * @param cached stamp read from the cache; gets the new mtime when it was written back
+     * @return whether the cache is valid
+     */
+    static bool validateCache(const std::string& sourcePath, FileStamp& source,
+                              const std::string& cachePath, size_t stampOffset, FileStamp& cached);
+};
+
+/**
+ * @brief Writes a file through a temporary file renamed over it, so readers never see a
+ * partial file. The temporary name is unique to the call: concurrent writers of the same
+ * file each rename a complete file (the last one wins).
+ * @param write fills the file
+ * @throws std::runtime_error if the file can not be written
+ */
+void writeFileAtomically(const std::string& filepath, const std::function<void(std::ostream&)>& write);
+
+/**
+ * @brief Read-only view of a whole file. Memory-mapped on POSIX systems (pages are loaded
+ * on demand and never copied), read into a buffer elsewhere.
+ */
+class MappedFile {
+public:
+    /**
+     * @param filepath file to map
+     * @param sequential hint that the file will be read front to back (read-ahead)
+     * @param copyOnWrite pages can be written through mutableData(); a written page becomes a
+     * private copy, the file is never modified
+     * @throws std::runtime_error if the file can not be opened or mapped
+     */
+    explicit MappedFile(const std::string& filepath, bool sequential = true, bool copyOnWrite = false);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    const char* data() const { return begin; }
+    char* mutableData() { return writable ? const_cast<char*>(begin) : nullptr; } // Only with copyOnWrite
+    size_t size() const { return length; }
+    std::string_view view() const { return std::string_view(begin, length); }
+
+private:
+    const char* begin = nullptr;
+    size_t length = 0;
+    bool mapped = false;        // begin comes from mmap (unmapped on destruction)
+    bool writable = false;      // Mapped copy-on-write (or buffer)
+    std::vector<char> buffer;   // Fallback storage when mmap is not available
+
+    void release();
+};
+
+}
+}
+}
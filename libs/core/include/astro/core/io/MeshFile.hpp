@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "astro/core/io/MappedFile.hpp"
+#include "astro/math/math.hpp"
+#include "astro/graphics/graphics.hpp"
+
+namespace astro {
+namespace core {
+namespace io {
+
+/**
+ * @brief Binary mesh (.astromesh): the final vertices, indices and bounds of a mesh, laid out
+ * so the memory-mapped file is used directly (no parsing, no copy).
+ *
+ * Layout (native endianness, offsets 64-byte aligned):
+ *   Header | VertexAttributes[vertexCount] | uint32_t[indexCount]
+ * The header records the size, modification time and hash of the source file; a cache whose
+ * stamp does not match its source is rebuilt (see loadOBJ).
+ */
+class MeshFile {
+public:
+    static constexpr char MAGIC[8] = {'A', 'S', 'T', 'R', 'O', 'M', 'S', 'H'};
+    static constexpr uint32_t VERSION = 1;
+    static constexpr size_t ALIGNMENT = 64;
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t vertexSize;     // sizeof(VertexAttributes) of the writer
+        uint64_t vertexCount;
+        uint64_t indexCount;
+        uint64_t vertexOffset;
+        uint64_t indexOffset;
+        FileStamp source;
+        float boundsMin[3];
+        float boundsMax[3];
+    };
+
+    /**
+     * @brief Maps an .astromesh file
+     * @throws std::runtime_error if the file can not be mapped or is not a valid mesh of this build
+     */
+    explicit MeshFile(const std::string& filepath);
+
+    /**
+     * @brief Mesh kept in memory (used when the cache can not be written)
+     */
+    MeshFile(std::vector<graphics::VertexAttributes> vertices, std::vector<uint32_t> indices);
+
+    std::span<const graphics::VertexAttributes> vertices() const { return vertexView; }
+    std::span<const uint32_t> indices() const { return indexView; }
+    const math::Vec3f& boundsMin() const { return minBounds; }
+    const math::Vec3f& boundsMax() const { return maxBounds; }
+    const FileStamp& source() const { return stamp; }
+    bool isMapped() const { return file.has_value(); }
+
+    /**
+     * @brief Writes vertices and indices as an .astromesh file (through a temporary file
+     * renamed at the end, so readers never see a partial mesh)
+     * @throws std::runtime_error if the file can not be written
+     */
+    static void write(const std::string& filepath, std::span<const graphics::VertexAttributes> vertices,
+                      std::span<const uint32_t> indices, const FileStamp& source = {});
+
+    /**
+     * @brief Cache file of an OBJ: same path with the .astromesh extension
+     */
+    static std::string cachePath(const std::string& objPath);
+
+    /**
+     * @brief Loads an OBJ through its binary cache. The cache is used when its size and mtime
+     * match the OBJ (or, if only the mtime changed, its content hash), otherwise the OBJ is
+     * parsed (see OBJFile) and the cache is rewritten. If the cache can not be written the
+     * parsed mesh is returned from memory.
+     * @param threads see OBJFile::loadFromFile
+     * @throws std::runtime_error if the OBJ can not be loaded
+     */
+    static MeshFile loadOBJ(const std::string& objPath, unsigned threads = 0);
+
+private:
+    std::optional<MappedFile> file;
+    std::vector<graphics::VertexAttributes> ownedVertices;
+    std::vector<uint32_t> ownedIndices;
+
+    std::span<const graphics::VertexAttributes> vertexView;
+    std::span<const uint32_t> indexView;
+    math::Vec3f minBounds = math::Vec3f(0.0f);
+    math::Vec3f maxBounds = math::Vec3f(0.0f);
+    FileStamp stamp{};
+};
+
+}
+}
+}
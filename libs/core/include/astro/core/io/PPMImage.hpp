@@ -1,10 +1,8 @@
 #pragma once
 
-#include <fstream>
-#include <ios>
-#include <iostream>
-#include <filesystem>
-#include <stdexcept>
+#include <cstddef>
+#include <cstdint>
+#include <string>
 
 #include "astro/graphics/graphics.hpp"
 
@@ -14,39 +12,23 @@ namespace io {
 
 class PPMImage {
 public:
-    static inline void writeImage(const std::string& path, const graphics::Texture& image){
-        std::filesystem::path out_path = path;
-        
-        if (out_path.extension().compare(".ppm") != 0) {
-            std::string error = "PPMImage extension should be '.ppm', not '" + out_path.extension().string() + "'.";
-            throw std::runtime_error( error );
-        }
-        if (!std::filesystem::exists(out_path.parent_path())) {
-            std::string error = "PPMImage output path does not exist: '" + out_path.parent_path().string() + "'.";
-            throw std::runtime_error( error );
-        }
-        if (std::filesystem::exists(out_path))
-            std::cout << "PPMImage Warning: overriding existing PPM Image.\n";
-        
-        // Open for truncating
-        std::ofstream fs(out_path, std::ios_base::trunc | std::ios_base::binary);
-
-        // Actual Writing
-
-        fs << magic_number << ' ' << image.width << ' ' << image.height << ' ';
-        fs << 255 << '\n'; // Max colo val
-        
-        for (int j = 0; j < image.height; j++){
-            for (int i = 0; i < image.width; i++){
-                graphics::Color col = getPixel(image, i, j);
-                fs << col.r << col.g << col.b;
-            }
-        }
-        
-        fs.close();
-    }
-
-    // static inline AstroCanvas readImage(const std::string& path){}
+    /**
+     * @brief Writes a binary (P6) PPM. Rows are packed to RGB in blocks and written in bulk.
+     * @throws std::runtime_error if the extension is not .ppm, the directory does not exist or
+     * the file can not be written
+     */
+    static void writeImage(const std::string& path, const graphics::Texture& image);
+
+    /**
+     * @brief Reads a binary (P6) PPM with 8-bit channels (the file is memory-mapped)
+     * @throws std::runtime_error if the file is missing, truncated or not an 8-bit P6 image
+     */
+    static graphics::Texture readImage(const std::string& path);
+
+    /**
+     * @brief Decodes a P6 PPM already in memory (see readImage)
+     */
+    static graphics::Texture readImageFromMemory(const uint8_t* data, size_t size);
 
 private:
     static constexpr const char magic_number[3] = "P6"; // 2 + null_terminating
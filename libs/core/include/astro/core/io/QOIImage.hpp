@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "astro/graphics/graphics.hpp"
+
+namespace astro {
+namespace core {
+namespace io {
+
+/**
+ * @brief QOI ("Quite OK Image") codec: lossless RGBA compression that encodes and decodes in
+ * a single pass, typically 3-5x smaller than uncompressed TGA/PPM for rendered frames.
+ * Specification: https://qoiformat.org/qoi-specification.pdf
+ */
+class QOIImage {
+public:
+    static constexpr int QOI_HEADER_SIZE = 14;
+    static constexpr int QOI_PADDING_SIZE = 8;
+    static constexpr uint64_t QOI_MAX_PIXELS = 400000000; // Limit of the reference implementation
+
+    /**
+     * @brief Encodes the texture and writes it with a single write
+     * @throws std::runtime_error if the texture is empty or too large, or the file can not be written
+     */
+    static void writeImage(const std::string& path, const graphics::Texture& image);
+
+    /**
+     * @brief Encodes the texture in memory. The header declares 3 channels when every pixel
+     * is opaque (informative only, decoding always produces RGBA).
+     * @throws std::runtime_error if the texture is empty or too large
+     */
+    static std::vector<uint8_t> encode(const graphics::Texture& image);
+
+    /**
+     * @brief Reads a QOI image (the file is memory-mapped and decoded straight into the texture)
+     * @throws std::runtime_error if the file is missing, truncated or not a valid QOI image
+     */
+    static graphics::Texture readImage(const std::string& path);
+
+    /**
+     * @brief Decodes a QOI image already in memory (see readImage)
+     */
+    static graphics::Texture readImageFromMemory(const uint8_t* data, size_t size);
+
+private:
+    static constexpr const char magic_number[5] = "qoif";
+};
+
+}
+}
+}
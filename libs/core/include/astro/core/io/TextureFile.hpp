@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "astro/core/io/MappedFile.hpp"
+#include "astro/graphics/graphics.hpp"
+
+namespace astro {
+namespace core {
+namespace io {
+
+/**
+ * @brief Binary texture (.astrotex): RGBA Color pixels ready to be sampled, optionally followed
+ * by their mip chain, so a warm start maps the file instead of decoding the image.
+ *
+ * Layout (native endianness, levels 64-byte aligned):
+ *   Header | Color[width * height] | Color[level 1] | ... (each level half the previous, min 1)
+ * Textures returned by level() reference the mapping (copy-on-write, the file is never modified).
+ */
+class TextureFile {
+public:
+    static constexpr char MAGIC[8] = {'A', 'S', 'T', 'R', 'O', 'T', 'E', 'X'};
+    static constexpr uint32_t VERSION = 1;
+    static constexpr size_t ALIGNMENT = 64;
+    static constexpr int MAX_LEVELS = 16; // Up to 32768 x 32768
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t pixelSize;      // sizeof(Color) of the writer
+        int32_t width;           // Level 0
+        int32_t height;
+        uint32_t levels;         // 1 without mips
+        uint32_t reserved;
+        FileStamp source;
+        uint64_t levelOffset[MAX_LEVELS];
+    };
+
+    /**
+     * @brief Maps an .astrotex file
+     * @throws std::runtime_error if the file can not be mapped or is not a valid texture of this build
+     */
+    explicit TextureFile(const std::string& filepath);
+
+    /**
+     * @brief Levels kept in memory (used when the cache can not be written)
+     */
+    explicit TextureFile(std::vector<graphics::Texture> levels);
+
+    int levels() const { return static_cast<int>(levelSizes.size()); }
+    int width(int level = 0) const { return levelSizes[level].first; }
+    int height(int level = 0) const { return levelSizes[level].second; }
+    const FileStamp& source() const { return stamp; }
+    bool isMapped() const { return file != nullptr; }
+
+    /**
+     * @brief Texture of a mip level without copying its pixels. The texture keeps the storage
+     * alive, and every texture of the same level shares the pixels (copy it before drawing on it).
+     */
+    graphics::Texture level(int level = 0) const;
+
+    /**
+     * @brief Writes a texture (and its box-filtered mip chain if 'mips') as an .astrotex file
+     * through a temporary file renamed at the end
+     * @throws std::runtime_error if the file can not be written or the texture is too large
+     */
+    static void write(const std::string& filepath, const graphics::Texture& image, bool mips = true,
+                      const FileStamp& source = {});
+
+    /**
+     * @brief Next mip level of a texture (2x2 box filter, odd sizes clamp at the border)
+     */
+    static graphics::Texture downsample(const graphics::Texture& image);
+
+    /**
+     * @brief Cache file of an image: same path with the .astrotex extension
+     */
+    static std::string cachePath(const std::string& imagePath);
+
+    /**
+     * @brief Loads a TGA through its binary cache, built on the first load (see TGAImage and
+     * FileStamp::validateCache for the invalidation rules). A cache without mips is rebuilt when 'mips'
+     * is requested. If the cache can not be written the decoded levels are returned from memory.
+     * @throws std::runtime_error if the TGA can not be loaded
+     */
+    static TextureFile loadTGA(const std::string& tgaPath, bool mips = true);
+
+private:
+    std::shared_ptr<MappedFile> file;
+    std::vector<std::shared_ptr<graphics::Texture>> ownedLevels;
+    std::vector<std::pair<int, int>> levelSizes;
+    std::vector<size_t> levelOffsets;
+    FileStamp stamp{};
+};
+
+}
+}
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "astro/core/io/FrameCapture.hpp"
+#include "astro/core/platform/IPlatformLayer.hpp"
+#include "astro/core/platform/LayerConfig.hpp"
+#include "astro/core/platform/SwapChain.hpp"
+#include "astro/graphics/graphics.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace astro {
+namespace core {
+namespace platform {
+
+/**
+ * @brief Offscreen platform layer. Frames are presented to an in-memory front buffer,
+ * so rendering runs at full speed without a display (benchmarks, batch rendering, CI).
+ */
+class HeadlessLayer : public IPlatformLayer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Options {
+        bool recordFrameTimes = false;  // Store the timestamp of every presented frame
+        std::string dumpDirectory = ""; // Write presented frames as PPM images here (disabled if empty)
+        int dumpEvery = 1;              // Only dump one of every 'dumpEvery' frames
+        std::string capturePath = "";   // Stream presented frames to this video file (disabled if empty)
+        io::FrameCapture::Options capture; // Format, ring length and drop policy of the capture
+    };
+
+    HeadlessLayer() = default;
+    explicit HeadlessLayer(const Options& options) : options(options) {}
+
+    ~HeadlessLayer() override {
+        close();
+    }
+
+    void initialize(const LayerConfig &layerConfig) override;
+    void processEvents(LayerEvent& layerEvent) override;
+    graphics::Texture& acquireCanvas() override;
+    void present(graphics::Texture& canvas) override;
+    void render(const graphics::Texture& canvas) override;
+    void close() override;
+
+    /**
+     * @brief Last presented frame (waits for queued frames first)
+     * @return const graphics::Texture&
+     */
+    const graphics::Texture& getFrontBuffer();
+
+    /**
+     * @brief Number of presented frames (waits for queued frames first)
+     * @return size_t
+     */
+    size_t getFrameCount();
+
+    /**
+     * @brief Presentation timestamps, only filled when Options::recordFrameTimes is set
+     * @return const std::vector<Clock::time_point>&
+     */
+    const std::vector<Clock::time_point>& getFrameTimestamps();
+
+    /**
+     * @brief Video capture of the presented frames, open when Options::capturePath is set
+     * (use it for the written/dropped frame counts)
+     * @return io::FrameCapture&
+     */
+    io::FrameCapture& getCapture() { return capture; }
+
+private:
+    Options options;
+    SwapChain swapChain;
+    io::FrameCapture capture;
+    graphics::Texture frontBuffer = graphics::Texture(0, 0);
+    std::vector<Clock::time_point> frameTimestamps;
+    size_t frameCount = 0;
+
+    void presentCanvas(const graphics::Texture& canvas, bool fullFrame = false);
+};
+
+}
+}
+}
@@ -21,7 +21,31 @@ public:
      */
     virtual void processEvents(LayerEvent& layerEvent)  = 0;
 
-    virtual void render(const graphics::Texture& canvas)  = 0;
+    /**
+     * @brief Get a canvas from the layer's swap chain to render the next frame into.
+     * It holds the previous frame and only its damaged regions are presented.
+     * May block until the presenter releases one.
+     * @return graphics::Texture& 
+     */
+    virtual graphics::Texture& acquireCanvas() = 0;
+
+    /**
+     * @brief Hand an acquired canvas to the layer for display.
+     * The canvas must not be modified until it is acquired again.
+     * @param canvas 
+     */
+    virtual void present(graphics::Texture& canvas) = 0;
+
+    /**
+     * @brief Display an externally owned canvas (copied into the swap chain)
+     * @param canvas 
+     */
+    virtual void render(const graphics::Texture& canvas) {
+        graphics::Texture& target = acquireCanvas();
+        target = canvas;
+        graphics::markAllDamaged(target); // Nothing is known about what changed
+        present(target);
+    }
     virtual void close()  = 0;
 
 };
@@ -34,6 +34,8 @@ struct LayerConfig {
     int displayHeight = 600;
     int colorDepth = 8; // number of bits per color value (8-bit color, 16-bit...)
     LayerEventType requestedEvents = LayerEventType::EvtNone; // Request of desired Layer events
+    bool asyncPresent = false; // Present frames on a background thread
+    int swapChainLength = 3; // Number of canvases in the swap chain when asyncPresent is set (2-3)
 };
 
 
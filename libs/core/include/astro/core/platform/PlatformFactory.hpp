@@ -1,8 +1,11 @@
 #pragma once
 
+#include <iostream>
 #include <memory>
+#include <stdexcept>
 
 #include "astro/core/platform/IPlatformLayer.hpp"
+#include "astro/core/platform/HeadlessLayer.hpp"
 
 #if defined(_WIN32)
     // Not implemented yer
@@ -18,9 +21,18 @@ namespace astro {
 namespace core {
 namespace platform {
 
+enum class PlatformType {
+    Native,     // Window on the current OS (X11 on Linux)
+    Headless,   // Offscreen in-memory presenter (no display needed)
+};
+
 class PlatformFactory {
 public:
-    static std::unique_ptr<IPlatformLayer> getPlatform() {
+    static std::unique_ptr<IPlatformLayer> getPlatform(PlatformType type = PlatformType::Native) {
+        if (type == PlatformType::Headless) {
+            return std::make_unique<HeadlessLayer>();
+        }
+
     #if defined(_WIN32)
         // Windows platform
         throw std::runtime_error("Currently, there is no support for Windows");
@@ -34,8 +46,8 @@ public:
             // Linux + X11 available
             return std::make_unique<X11Layer>();
         #else
-            std::cerr << "[PlatformFactory] Warning: X11 not available — no platform layer created.\n";
-            return nullptr;
+            std::cerr << "[PlatformFactory] Warning: X11 not available — falling back to the headless layer.\n";
+            return std::make_unique<HeadlessLayer>();
         #endif
 
     #else
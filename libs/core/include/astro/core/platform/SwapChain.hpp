@@ -0,0 +1,100 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "astro/graphics/graphics.hpp"
+
+namespace astro {
+namespace core {
+namespace platform {
+
+/**
+ * @brief Ring of canvases shared between the renderer and the presenter.
+ * In async mode a presenter thread consumes finished frames while the renderer
+ * works on the next one. In sync mode a single canvas is presented in place.
+ * Acquired canvases always hold the last submitted frame, with an empty damage list,
+ * so only the regions drawn during the frame need to be presented.
+ */
+class SwapChain {
+public:
+    static constexpr int MAX_LENGTH = 3;
+    using PresentFn = std::function<void(const graphics::Texture&)>;
+
+    SwapChain() = default;
+    ~SwapChain() { shutdown(); }
+    SwapChain(const SwapChain&) = delete;
+    SwapChain& operator=(const SwapChain&) = delete;
+
+    /**
+     * @brief Allocates the canvases and starts the presenter thread (if async)
+     * @param width canvas width
+     * @param height canvas height
+     * @param length number of canvases when async (clamped to [2, MAX_LENGTH]), sync mode uses one
+     * @param async present on a background thread
+     * @param presentFn function that sends a finished canvas to the display
+     */
+    void initialize(int width, int height, int length, bool async, PresentFn presentFn);
+
+    /**
+     * @brief Get a free canvas to render the next frame into.
+     * Blocks while every canvas is queued or being presented. Regions damaged by
+     * the frames it missed are copied from the last submitted canvas.
+     * @return graphics::Texture&
+     */
+    graphics::Texture& acquire();
+
+    /**
+     * @brief Hand an acquired canvas over for presentation.
+     * The canvas must not be touched until it is acquired again.
+     * @param canvas
+     */
+    void present(graphics::Texture& canvas);
+
+    /**
+     * @brief Blocks until every queued frame has been presented
+     */
+    void flush();
+
+    /**
+     * @brief Stops the presenter thread after presenting the queued frames
+     */
+    void shutdown();
+
+    bool isAsync() const { return async; }
+    int length() const { return static_cast<int>(canvases.size()); }
+
+private:
+    std::vector<std::unique_ptr<graphics::Texture>> canvases; // Stable addresses
+    std::deque<graphics::Texture*> freeCanvases;
+    std::deque<graphics::Texture*> readyCanvases;
+    graphics::Texture* presenting = nullptr;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::thread presenter;
+    std::exception_ptr presenterError = nullptr;
+    bool async = false;
+    bool running = false;
+    PresentFn presentFn;
+
+    // Damage bookkeeping to bring acquired canvases up to date with the last submitted frame
+    std::vector<long> canvasFrames; // Frame last submitted with each canvas (-1 if never)
+    std::deque<std::vector<graphics::Rect>> damageHistory; // Damage of the last MAX_LENGTH frames
+    long submittedFrames = 0;
+    graphics::Texture* lastSubmitted = nullptr;
+
+    int canvasSlot(const graphics::Texture* canvas) const;
+    void presenterLoop();
+    void rethrowPresenterError();
+};
+
+}
+}
+}
@@ -2,8 +2,10 @@
 
 #include "astro/core/platform/IPlatformLayer.hpp"
 #include "astro/core/platform/LayerConfig.hpp"
+#include "astro/core/platform/SwapChain.hpp"
 #include "astro/graphics/graphics.hpp"
 
+#include <atomic>
 #include <vector>
 #include <X11/Xlib.h>
 
@@ -22,10 +24,13 @@ public:
 
     void initialize(const LayerConfig &layerConfig) override;
     void processEvents(LayerEvent& layerEvent) override;
+    graphics::Texture& acquireCanvas() override;
+    void present(graphics::Texture& canvas) override;
     void render(const graphics::Texture& canvas) override;
     void close() override;
 
 private:
+    SwapChain swapChain;                // Canvases shared with the (optional) presenter thread
     std::vector<uint8_t> rendering_buffer;
     Display* display;                   // Conection handler with the XServer
     Window window;                      // Application window
@@ -36,25 +41,34 @@ private:
     XIM inputMethod; XIC inputContext;  // Parsing key inputs into strings
     
     int windowWidth, windowHeight = 0;
+    std::atomic<bool> fullPresentRequested = true; // Present the whole window instead of the damage
 
     void fillKeyEventWithData(XKeyEvent* xkey_event, KeyboardEventData& key_data);
+    void presentCanvas(const graphics::Texture& canvas, bool fullFrame = false);
     long layerEventToX11(LayerEventType requestedEvents);
 
+    /**
+     * @brief Converts 'count' RGBA canvas pixels into the XImage pixel format
+     */
+    using ConvertRowFn = void (*)(const graphics::Color* src, uint8_t* dst, int count);
+
     struct RenderConfig {
         int x_bpp = 0; // Bytes per pixel for XImage (e.g., 4)
         int x_bpr = 0; // Total bytes per line for XImage (includes padding)
 
-        // Pre-calculate format checks to avoid branching in the rendering loop
-        bool is_32bit = false;
-        bool is_lsb = false;
-        bool is_msb = false;
-        bool is_24bit_lsb = false;
-        bool is_24bit_msb = false;
+        // Conversion kernel chosen once at initialize() to avoid branching in the rendering loop
+        ConvertRowFn convertRow = nullptr;
         
         RenderConfig() = default;
-        RenderConfig(int x_bpp, int x_bpr, bool is_32bit, bool is_lsb, bool is_msb, bool is_24bit_lsb, bool is_24bit_msb):
-            x_bpp(x_bpp), x_bpr(x_bpr), is_32bit(is_32bit), is_lsb(is_lsb), is_msb(is_msb), is_24bit_lsb(is_24bit_lsb), is_24bit_msb(is_24bit_msb) {}
+        RenderConfig(int x_bpp, int x_bpr, ConvertRowFn convertRow):
+            x_bpp(x_bpp), x_bpr(x_bpr), convertRow(convertRow) {}
     } m_xrendering;
+
+    /**
+     * @brief Picks the fastest conversion kernel for the XImage format and the running CPU
+     * @return nullptr if the pixel format is not supported
+     */
+    static ConvertRowFn selectConvertRow(int x_bpp, int byte_order);
 };
 
 }
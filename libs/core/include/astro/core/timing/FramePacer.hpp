@@ -0,0 +1,119 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+
+namespace astro {
+namespace core {
+namespace timing {
+
+/**
+ * @brief Parts of a frame whose duration is tracked by the FramePacer
+ */
+enum class FrameSection : int {
+    Update = 0,
+    Render,
+    Present,
+    Count
+};
+
+/**
+ * @brief Rolling frame time statistics (milliseconds) over the last FramePacer::HISTORY_LENGTH frames
+ */
+struct FrameStats {
+    size_t frames = 0;      // Frames in the rolling window
+    double minFrameMs = 0.0;
+    double avgFrameMs = 0.0;
+    double p99FrameMs = 0.0;
+    double maxFrameMs = 0.0;
+    double avgFps = 0.0;
+
+    // Average time spent per section
+    double avgUpdateMs = 0.0;
+    double avgRenderMs = 0.0;
+    double avgPresentMs = 0.0;
+};
+
+/**
+ * @brief Paces the main loop to a target frame rate. Each frame only waits for the
+ * remaining budget: it sleeps until close to the deadline and spin-waits the tail.
+ */
+class FramePacer {
+public:
+    using Clock = std::chrono::steady_clock;
+    static constexpr int HISTORY_LENGTH = 240;
+
+    /**
+     * @brief RAII timer that adds its lifetime to a frame section
+     */
+    class ScopedSection {
+    public:
+        ScopedSection(FramePacer& pacer, FrameSection section)
+            : pacer(pacer), section(section), start(Clock::now()) {}
+        ~ScopedSection() { pacer.addSectionTime(section, Clock::now() - start); }
+        ScopedSection(const ScopedSection&) = delete;
+        ScopedSection& operator=(const ScopedSection&) = delete;
+    private:
+        FramePacer& pacer;
+        FrameSection section;
+        Clock::time_point start;
+    };
+
+    /**
+     * @param targetFps frames per second (<= 0 to run unthrottled)
+     * @param spinThresholdMs last part of the wait that is spin-waited instead of slept
+     */
+    explicit FramePacer(double targetFps = 60.0, double spinThresholdMs = 1.0);
+
+    void setTargetFps(double targetFps);
+    double getTargetFps() const { return targetFps; }
+
+    /**
+     * @brief Restarts the current frame and the pacing deadlines (stats are kept)
+     */
+    void reset();
+
+    /**
+     * @brief Measure the duration of a section of the current frame
+     * @return ScopedSection timer
+     */
+    ScopedSection section(FrameSection section) { return ScopedSection(*this, section); }
+
+    /**
+     * @brief Adds time to a section of the current frame
+     */
+    void addSectionTime(FrameSection section, Clock::duration duration);
+
+    /**
+     * @brief Waits for the remaining frame budget, records the frame and starts the next one
+     */
+    void endFrame();
+
+    /**
+     * @brief Statistics of the last HISTORY_LENGTH frames
+     * @return FrameStats
+     */
+    FrameStats getStats() const;
+
+private:
+    static constexpr int SECTIONS = static_cast<int>(FrameSection::Count);
+
+    double targetFps;
+    Clock::duration frameBudget;
+    Clock::duration spinThreshold;
+    Clock::time_point frameStart;
+    Clock::time_point deadline;
+
+    // Current frame section times
+    std::array<Clock::duration, SECTIONS> currentSections{};
+
+    // Rolling history (ring buffers)
+    std::array<double, HISTORY_LENGTH> frameMs{};
+    std::array<std::array<double, SECTIONS>, HISTORY_LENGTH> sectionMs{};
+    size_t recordedFrames = 0;
+};
+
+}
+}
+}
@@ -0,0 +1,80 @@
+#include "astro/core/io/AssetLoader.hpp"
+
+#include <algorithm>
+
+namespace astro {
+namespace core {
+namespace io {
+
+    AssetLoader::AssetLoader(unsigned threads, AssetRegistry* registry) : registry(registry) {
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned i = 0; i < threads; ++i) {
+            workers.emplace_back(&AssetLoader::workerLoop, this);
+        }
+    }
+
+    AssetLoader::~AssetLoader() {
+        // Chained jobs are queued by the jobs they depend on: wait for all of them before stopping
+        wait();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            running = false;
+            cv.notify_all();
+        }
+        for (std::thread& worker : workers) worker.join();
+    }
+
+    AssetHandle<graphics::Texture> AssetLoader::loadImage(const std::string& path) {
+        if (registry) return runShared<graphics::Texture>([r = registry, path] { return r->texture(path); });
+        return run([path] { return AssetRegistry::readImage(path); });
+    }
+
+    AssetHandle<TextureFile> AssetLoader::loadTexture(const std::string& path, bool mips) {
+        if (registry && mips) return runShared<TextureFile>([r = registry, path] { return r->textureFile(path); });
+        return run([path, mips] { return TextureFile::loadTGA(path, mips); });
+    }
+
+    AssetHandle<OBJFile> AssetLoader::loadOBJ(const std::string& path, unsigned threads) {
+        if (registry) return runShared<OBJFile>([r = registry, path, threads] { return r->obj(path, threads); });
+        return run([path, threads] { return OBJFile(path, threads); });
+    }
+
+    AssetHandle<MeshFile> AssetLoader::loadMesh(const std::string& path, unsigned threads) {
+        if (registry) return runShared<MeshFile>([r = registry, path, threads] { return r->mesh(path, threads); });
+        return run([path, threads] { return MeshFile::loadOBJ(path, threads); });
+    }
+
+    void AssetLoader::wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this] { return pending == 0; });
+    }
+
+    void AssetLoader::enqueue(std::function<void()> job) {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.push_back(std::move(job));
+        cv.notify_all();
+    }
+
+    void AssetLoader::workerLoop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            cv.wait(lock, [this] { return !jobs.empty() || !running; });
+            if (jobs.empty()) break; // Stopped and nothing left to run
+
+            std::function<void()> job = std::move(jobs.front());
+            jobs.pop_front();
+
+            // Jobs never throw: their errors are stored in the handles
+            lock.unlock();
+            job();
+            job = nullptr;
+            lock.lock();
+
+            pending--;
+            cv.notify_all();
+        }
+    }
+
+}
+}
+}
@@ -0,0 +1,128 @@
+#include "astro/core/io/AssetRegistry.hpp"
+#include "astro/core/io/QOIImage.hpp"
+#include "astro/core/io/TGAImage.hpp"
+
+#include <filesystem>
+#include <stdexcept>
+
+namespace astro {
+namespace core {
+namespace io {
+
+    std::shared_ptr<graphics::Texture> AssetRegistry::texture(const std::string& path) {
+        return get<graphics::Texture>(path, [](const std::string& file) { return readImage(file); });
+    }
+
+    std::shared_ptr<TextureFile> AssetRegistry::textureFile(const std::string& path) {
+        return get<TextureFile>(path, [](const std::string& file) { return TextureFile::loadTGA(file); });
+    }
+
+    std::shared_ptr<OBJFile> AssetRegistry::obj(const std::string& path, unsigned threads) {
+        return get<OBJFile>(path, [threads](const std::string& file) { return OBJFile(file, threads); });
+    }
+
+    std::shared_ptr<MeshFile> AssetRegistry::mesh(const std::string& path, unsigned threads) {
+        return get<MeshFile>(path, [threads](const std::string& file) { return MeshFile::loadOBJ(file, threads); });
+    }
+
+    size_t AssetRegistry::liveCount() {
+        std::lock_guard<std::mutex> lock(mutex);
+        size_t live = 0;
+        for (const auto& [key, entry] : byPath) live += entry.asset.expired() ? 0 : 1;
+        return live;
+    }
+
+    void AssetRegistry::purge() {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::erase_if(byPath, [](const auto& item) { return item.second.asset.expired(); });
+        std::erase_if(byContent, [](const auto& item) { return item.second.expired(); });
+    }
+
+    AssetRegistry::Stats AssetRegistry::stats() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return counters;
+    }
+
+    graphics::Texture AssetRegistry::readImage(const std::string& path) {
+        if (std::filesystem::path(path).extension() == ".qoi") return QOIImage::readImage(path);
+        return TGAImage::readImage(path);
+    }
+
+    std::string AssetRegistry::canonicalPath(const std::string& path) {
+        std::error_code ec;
+        const std::filesystem::path canonical = std::filesystem::weakly_canonical(path, ec);
+        return ec ? path : canonical.string();
+    }
+
+    std::shared_ptr<void> AssetRegistry::lookup(std::type_index type, const std::string& key, FileStamp& stamp) {
+        // 1. Same path, unchanged file (size and mtime, no read)
+        stamp = FileStamp::quick(key);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            const auto it = byPath.find({type, key});
+            if (it != byPath.end()) {
+                std::shared_ptr<void> asset = it->second.asset.lock();
+                if (asset && it->second.stamp.size == stamp.size && it->second.stamp.mtime == stamp.mtime) {
+                    counters.pathHits++;
+                    return asset;
+                }
+                byPath.erase(it); // Freed or modified
+            }
+        }
+
+        if (!shareContent) return nullptr;
+
+        // 2. Same content under another path (or the same file touched)
+        stamp = FileStamp::of(key);
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto it = byContent.find({type, stamp.size, stamp.hash});
+        if (it == byContent.end()) return nullptr;
+        std::shared_ptr<void> asset = it->second.lock();
+        if (!asset) {
+            byContent.erase(it);
+            return nullptr;
+        }
+        byPath[{type, key}] = Entry{stamp, asset};
+        counters.contentHits++;
+        return asset;
+    }
+
+    std::shared_ptr<void> AssetRegistry::insert(std::type_index type, const std::string& key, const FileStamp& stamp, std::shared_ptr<void> asset) {
+        // A file changed during the load may not hold the content of 'stamp': keep the asset out
+        // of the content index (its path entry keeps the old stamp, so the next request reloads)
+        bool unchanged = false;
+        try {
+            const FileStamp now = FileStamp::quick(key);
+            unchanged = now.size == stamp.size && now.mtime == stamp.mtime;
+        } catch (std::runtime_error&) {
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        Entry& entry = byPath[{type, key}];
+        if (std::shared_ptr<void> existing = entry.asset.lock();
+            existing && unchanged && entry.stamp.size == stamp.size && entry.stamp.mtime == stamp.mtime) {
+            // Loaded by another thread in the meantime: share the registered instance
+            return existing;
+        }
+        if (shareContent && unchanged) {
+            std::weak_ptr<void>& byHash = byContent[{type, stamp.size, stamp.hash}];
+            if (std::shared_ptr<void> existing = byHash.lock()) {
+                entry = Entry{stamp, existing};
+                return existing;
+            }
+            byHash = asset;
+        }
+        entry = Entry{stamp, asset};
+        counters.loads++;
+        return asset;
+    }
+
+    std::shared_ptr<void> AssetRegistry::findLive(std::type_index type, const std::string& key) {
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto it = byPath.find({type, key});
+        return it == byPath.end() ? nullptr : it->second.asset.lock();
+    }
+
+}
+}
+}
@@ -0,0 +1,289 @@
+#include "astro/core/io/FrameCapture.hpp"
+#include "PixelRows.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+namespace astro {
+namespace core {
+namespace io {
+
+namespace {
+    // BT.601 limited range, 8-bit fixed point: Y in [16, 235], U/V in [16, 240].
+    // Chroma is computed from the sum of each 2x2 block, hence the extra 2 bits of shift.
+    inline uint8_t luma(const uint8_t* p) {
+        return static_cast<uint8_t>(((66 * p[0] + 129 * p[1] + 25 * p[2] + 128) >> 8) + 16);
+    }
+    inline uint8_t chromaU(int r, int g, int b) { return static_cast<uint8_t>(((-38 * r - 74 * g + 112 * b + 512) >> 10) + 128); }
+    inline uint8_t chromaV(int r, int g, int b) { return static_cast<uint8_t>(((112 * r - 94 * g - 18 * b + 512) >> 10) + 128); }
+
+    // Two source rows to two luma rows and one row of each chroma plane, starting at column 'x' (even)
+    using I420RowsFn = void (*)(const graphics::Color* row0, const graphics::Color* row1, int width,
+                                uint8_t* y0, uint8_t* y1, uint8_t* u, uint8_t* v);
+
+    void i420RowsScalarFrom(int x, const graphics::Color* row0, const graphics::Color* row1, int width,
+                            uint8_t* y0, uint8_t* y1, uint8_t* u, uint8_t* v) {
+        for (; x < width; x += 2) {
+            const int x1 = std::min(x + 1, width - 1);
+            const uint8_t* a = reinterpret_cast<const uint8_t*>(row0 + x);
+            const uint8_t* b = reinterpret_cast<const uint8_t*>(row0 + x1);
+            const uint8_t* c = reinterpret_cast<const uint8_t*>(row1 + x);
+            const uint8_t* d = reinterpret_cast<const uint8_t*>(row1 + x1);
+            y0[x] = luma(a);
+            y1[x] = luma(c);
+            if (x + 1 < width) {
+                y0[x + 1] = luma(b);
+                y1[x + 1] = luma(d);
+            }
+            const int r = a[0] + b[0] + c[0] + d[0];
+            const int g = a[1] + b[1] + c[1] + d[1];
+            const int bl = a[2] + b[2] + c[2] + d[2];
+            u[x / 2] = chromaU(r, g, bl);
+            v[x / 2] = chromaV(r, g, bl);
+        }
+    }
+
+    void i420RowsScalar(const graphics::Color* row0, const graphics::Color* row1, int width,
+                        uint8_t* y0, uint8_t* y1, uint8_t* u, uint8_t* v) {
+        i420RowsScalarFrom(0, row0, row1, width, y0, y1, u, v);
+    }
+
+#ifdef ASTRO_IO_SIMD_X86
+    // 4 luma values (32-bit) from 4 pixels widened to 16-bit channels (2 per register)
+    __attribute__((target("ssse3")))
+    inline __m128i lumaSSSE3(__m128i p01, __m128i p23, __m128i coef, __m128i round) {
+        const __m128i sums = _mm_hadd_epi32(_mm_madd_epi16(p01, coef), _mm_madd_epi16(p23, coef));
+        return _mm_srai_epi32(_mm_add_epi32(sums, round), 8);
+    }
+
+    // 4 chroma values (32-bit) from 4 2x2 block sums (16-bit channels, 2 blocks per register)
+    __attribute__((target("ssse3")))
+    inline __m128i chromaSSSE3(__m128i blocks01, __m128i blocks23, __m128i coef, __m128i round) {
+        const __m128i sums = _mm_hadd_epi32(_mm_madd_epi16(blocks01, coef), _mm_madd_epi16(blocks23, coef));
+        return _mm_srai_epi32(_mm_add_epi32(sums, round), 10);
+    }
+
+    // Adds the two pixels of a widened register: the low 4 lanes hold the sum
+    __attribute__((target("ssse3")))
+    inline __m128i pairSum(__m128i p) { return _mm_add_epi16(p, _mm_srli_si128(p, 8)); }
+
+    __attribute__((target("ssse3")))
+    void i420RowsSSSE3(const graphics::Color* row0, const graphics::Color* row1, int width,
+                       uint8_t* y0, uint8_t* y1, uint8_t* u, uint8_t* v) {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i coefY = _mm_setr_epi16(66, 129, 25, 0, 66, 129, 25, 0);
+        const __m128i coefU = _mm_setr_epi16(-38, -74, 112, 0, -38, -74, 112, 0);
+        const __m128i coefV = _mm_setr_epi16(112, -94, -18, 0, 112, -94, -18, 0);
+        const __m128i roundY = _mm_set1_epi32(128), roundC = _mm_set1_epi32(512);
+        const __m128i offsetY = _mm_set1_epi16(16), offsetC = _mm_set1_epi16(128);
+
+        // 8 pixels of both rows per iteration: 16 luma and 4 + 4 chroma values
+        int x = 0;
+        for (; x + 8 <= width; x += 8) {
+            const __m128i a0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + x));
+            const __m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + x + 4));
+            const __m128i a1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + x));
+            const __m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + x + 4));
+            const __m128i p00 = _mm_unpacklo_epi8(a0, zero), p01 = _mm_unpackhi_epi8(a0, zero);
+            const __m128i p02 = _mm_unpacklo_epi8(b0, zero), p03 = _mm_unpackhi_epi8(b0, zero);
+            const __m128i p10 = _mm_unpacklo_epi8(a1, zero), p11 = _mm_unpackhi_epi8(a1, zero);
+            const __m128i p12 = _mm_unpacklo_epi8(b1, zero), p13 = _mm_unpackhi_epi8(b1, zero);
+
+            const __m128i l0 = _mm_add_epi16(_mm_packs_epi32(lumaSSSE3(p00, p01, coefY, roundY), lumaSSSE3(p02, p03, coefY, roundY)), offsetY);
+            const __m128i l1 = _mm_add_epi16(_mm_packs_epi32(lumaSSSE3(p10, p11, coefY, roundY), lumaSSSE3(p12, p13, coefY, roundY)), offsetY);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(y0 + x), _mm_packus_epi16(l0, l0));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(y1 + x), _mm_packus_epi16(l1, l1));
+
+            const __m128i blocks01 = _mm_unpacklo_epi64(pairSum(_mm_add_epi16(p00, p10)), pairSum(_mm_add_epi16(p01, p11)));
+            const __m128i blocks23 = _mm_unpacklo_epi64(pairSum(_mm_add_epi16(p02, p12)), pairSum(_mm_add_epi16(p03, p13)));
+            const __m128i cu = _mm_add_epi16(_mm_packs_epi32(chromaSSSE3(blocks01, blocks23, coefU, roundC), zero), offsetC);
+            const __m128i cv = _mm_add_epi16(_mm_packs_epi32(chromaSSSE3(blocks01, blocks23, coefV, roundC), zero), offsetC);
+            const int packedU = _mm_cvtsi128_si32(_mm_packus_epi16(cu, cu));
+            const int packedV = _mm_cvtsi128_si32(_mm_packus_epi16(cv, cv));
+            std::memcpy(u + x / 2, &packedU, 4);
+            std::memcpy(v + x / 2, &packedV, 4);
+        }
+        i420RowsScalarFrom(x, row0, row1, width, y0, y1, u, v);
+    }
+#endif
+
+    I420RowsFn selectI420Rows() {
+#ifdef ASTRO_IO_SIMD_X86
+        if (__builtin_cpu_supports("ssse3")) return i420RowsSSSE3;
+#endif
+        return i420RowsScalar;
+    }
+}
+
+    void FrameCapture::rgbaToI420(const graphics::Color* pixels, int width, int height, uint8_t* yPlane, uint8_t* uPlane, uint8_t* vPlane) {
+        const I420RowsFn rows = selectI420Rows();
+        const int chromaWidth = (width + 1) / 2;
+        for (int y = 0; y < height; y += 2) {
+            // An odd last row is paired with itself
+            const int y1 = std::min(y + 1, height - 1);
+            rows(pixels + static_cast<size_t>(y) * width, pixels + static_cast<size_t>(y1) * width, width,
+                 yPlane + static_cast<size_t>(y) * width, yPlane + static_cast<size_t>(y1) * width,
+                 uPlane + static_cast<size_t>(y / 2) * chromaWidth, vPlane + static_cast<size_t>(y / 2) * chromaWidth);
+        }
+    }
+
+    void FrameCapture::open(const std::string& path, int width, int height, const Options& options) {
+        close();
+        if (width <= 0 || height <= 0) throw std::runtime_error("FrameCapture Error: Invalid frame size.");
+
+        file = std::ofstream(path, std::ios_base::binary | std::ios_base::trunc);
+        if (!file) throw std::runtime_error("FrameCapture Error: Could not open file for writing: " + path);
+        if (options.format == Format::Y4M) {
+            // 'C420jpeg': chroma sited at the center of each 2x2 block, as averaged by rgbaToI420
+            char header[96];
+            const int length = std::snprintf(header, sizeof(header), "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n",
+                                             width, height, std::max(options.fps, 1));
+            file.write(header, length);
+        }
+
+        this->options = options;
+        this->width = width;
+        this->height = height;
+        buffers.clear();
+        freeBuffers.clear();
+        readyBuffers.clear();
+        writing = false;
+        writerError = nullptr;
+        submitted = written = dropped = 0;
+        for (int i = 0; i < std::max(options.ringLength, 1); ++i) {
+            buffers.push_back(std::make_unique<std::vector<graphics::Color>>(static_cast<size_t>(width) * height));
+            freeBuffers.push_back(buffers.back().get());
+        }
+
+        running = true;
+        opened = true;
+        writer = std::thread(&FrameCapture::writerLoop, this);
+    }
+
+    bool FrameCapture::submit(const graphics::Texture& frame) {
+        std::vector<graphics::Color>* buffer = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (!opened) throw std::runtime_error("FrameCapture Error: submit() called on a closed capture.");
+            rethrowWriterError();
+            if (frame.width != width || frame.height != height) {
+                throw std::runtime_error("FrameCapture Error: Frame size does not match the capture size.");
+            }
+
+            ++submitted;
+            if (freeBuffers.empty()) {
+                if (!options.blockWhenFull) {
+                    ++dropped;
+                    return false;
+                }
+                cv.wait(lock, [this] { return !freeBuffers.empty() || writerError; });
+                rethrowWriterError();
+            }
+            buffer = freeBuffers.front();
+            freeBuffers.pop_front();
+        }
+
+        // The buffer belongs to the caller until it is queued: copy without the lock
+        std::copy(frame.data.data(), frame.data.data() + buffer->size(), buffer->data());
+
+        std::lock_guard<std::mutex> lock(mutex);
+        readyBuffers.push_back(buffer);
+        cv.notify_all();
+        return true;
+    }
+
+    void FrameCapture::flush() {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this] { return (readyBuffers.empty() && !writing) || writerError || !running; });
+        rethrowWriterError();
+    }
+
+    void FrameCapture::close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            running = false;
+            cv.notify_all();
+        }
+        if (writer.joinable()) writer.join();
+        if (file.is_open()) file.close();
+        opened = false;
+    }
+
+    size_t FrameCapture::submittedFrames() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return submitted;
+    }
+
+    size_t FrameCapture::writtenFrames() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return written;
+    }
+
+    size_t FrameCapture::droppedFrames() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return dropped;
+    }
+
+    void FrameCapture::writerLoop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            cv.wait(lock, [this] { return !readyBuffers.empty() || !running; });
+            if (readyBuffers.empty()) break; // Stopped and every queued frame written
+
+            std::vector<graphics::Color>* buffer = readyBuffers.front();
+            readyBuffers.pop_front();
+            writing = true;
+
+            // Convert and write without holding the lock so the renderer can keep queueing frames
+            lock.unlock();
+            std::exception_ptr error = nullptr;
+            try {
+                writeFrame(*buffer);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            lock.lock();
+
+            freeBuffers.push_back(buffer);
+            writing = false;
+            if (error) {
+                // Errors are sticky: queued frames are discarded and the next call reports the error
+                writerError = error;
+                freeBuffers.insert(freeBuffers.end(), readyBuffers.begin(), readyBuffers.end());
+                readyBuffers.clear();
+                running = false;
+            } else {
+                ++written;
+            }
+            cv.notify_all();
+        }
+    }
+
+    void FrameCapture::writeFrame(const std::vector<graphics::Color>& frame) {
+        const size_t pixels = static_cast<size_t>(width) * height;
+        if (options.format == Format::Y4M) {
+            static constexpr char FRAME_TAG[] = "FRAME\n";
+            const size_t tagBytes = sizeof(FRAME_TAG) - 1;
+            const size_t chromaBytes = static_cast<size_t>((width + 1) / 2) * ((height + 1) / 2);
+            encoded.resize(tagBytes + pixels + 2 * chromaBytes);
+            std::memcpy(encoded.data(), FRAME_TAG, tagBytes);
+            uint8_t* yPlane = encoded.data() + tagBytes;
+            rgbaToI420(frame.data(), width, height, yPlane, yPlane + pixels, yPlane + pixels + chromaBytes);
+        } else {
+            encoded.resize(pixels * 3);
+            detail::selectPackRow24<0, 1, 2>()(frame.data(), encoded.data(), pixels);
+        }
+
+        file.write(reinterpret_cast<const char*>(encoded.data()), static_cast<std::streamsize>(encoded.size()));
+        if (!file) throw std::runtime_error("FrameCapture Error: Could not write frame.");
+    }
+
+    void FrameCapture::rethrowWriterError() {
+        if (writerError) std::rethrow_exception(writerError);
+    }
+
+}
+}
+}
@@ -0,0 +1,187 @@
+#include "astro/core/io/MappedFile.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define ASTRO_HAS_MMAP
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace astro {
+namespace core {
+namespace io {
+
+namespace {
+    // 64-bit content hash (8 bytes per step, not cryptographic)
+    uint64_t hashBytes(const char* data, size_t size) {
+        constexpr uint64_t PRIME = 0x100000001B3ull * 0x9E3779B97F4A7C15ull | 1;
+        uint64_t h = 0xCBF29CE484222325ull ^ size;
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8) {
+            uint64_t word;
+            std::memcpy(&word, data + i, 8);
+            h = (h ^ word) * PRIME;
+            h ^= h >> 32;
+        }
+        for (; i < size; ++i) h = (h ^ static_cast<unsigned char>(data[i])) * PRIME;
+        return h ^ (h >> 29);
+    }
+
+    // Temporary file next to 'filepath', unique to the process and the call
+    std::string temporaryPath(const std::string& filepath) {
+        static std::atomic<uint64_t> counter = 0;
+#ifdef ASTRO_HAS_MMAP
+        static const uint64_t process = static_cast<uint64_t>(::getpid());
+#else
+        static const uint64_t process = std::random_device{}();
+#endif
+        return filepath + ".tmp" + std::to_string(process) + "-" + std::to_string(counter++);
+    }
+}
+
+    FileStamp FileStamp::quick(const std::string& filepath) {
+        std::error_code ec;
+        FileStamp stamp{};
+        stamp.size = std::filesystem::file_size(filepath, ec);
+        if (ec) throw std::runtime_error("MappedFile Error: File not found: " + filepath);
+        stamp.mtime = static_cast<int64_t>(std::filesystem::last_write_time(filepath, ec).time_since_epoch().count());
+        return stamp;
+    }
+
+    FileStamp FileStamp::of(const std::string& filepath) {
+        FileStamp stamp = quick(filepath);
+        const MappedFile file(filepath);
+        stamp.hash = hashBytes(file.data(), file.size());
+        return stamp;
+    }
+
+    bool FileStamp::validateCache(const std::string& sourcePath, FileStamp& source,
+                                  const std::string& cachePath, size_t stampOffset, FileStamp& cached) {
+        if (cached.size != source.size) return false;
+        if (cached.mtime == source.mtime) return true;
+
+        // Same size, new mtime: same content after a touch/checkout?
+        source = of(sourcePath);
+        if (cached.hash != source.hash) return false;
+
+        // Record the new mtime so the next check skips the hash (the cache stays valid if it fails)
+        std::fstream fs(cachePath, std::ios_base::binary | std::ios_base::in | std::ios_base::out);
+        fs.seekp(static_cast<std::streamoff>(stampOffset + offsetof(FileStamp, mtime)));
+        fs.write(reinterpret_cast<const char*>(&source.mtime), sizeof(source.mtime));
+        if (!fs.flush()) {
+            std::cerr << "MappedFile Warning: Could not update the source stamp of " << cachePath << "." << std::endl;
+        }
+        cached.mtime = source.mtime;
+        return true;
+    }
+
+    void writeFileAtomically(const std::string& filepath, const std::function<void(std::ostream&)>& write) {
+        const std::string tempPath = temporaryPath(filepath);
+        {
+            std::ofstream fs(tempPath, std::ios_base::binary | std::ios_base::trunc);
+            if (!fs) throw std::runtime_error("MappedFile Error: Could not open file for writing: " + tempPath);
+            try {
+                write(fs);
+            } catch (...) {
+                fs.close();
+                std::filesystem::remove(tempPath);
+                throw;
+            }
+            if (!fs.flush()) {
+                fs.close();
+                std::filesystem::remove(tempPath);
+                throw std::runtime_error("MappedFile Error: Could not write file: " + tempPath);
+            }
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(tempPath, filepath, ec);
+        if (ec) {
+            std::filesystem::remove(tempPath, ec);
+            throw std::runtime_error("MappedFile Error: Could not write file: " + filepath);
+        }
+    }
+
+#ifdef ASTRO_HAS_MMAP
+    MappedFile::MappedFile(const std::string& filepath, bool sequential, bool copyOnWrite) {
+        const int fd = ::open(filepath.c_str(), O_RDONLY);
+        if (fd < 0) throw std::runtime_error("MappedFile Error: File not found: " + filepath);
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw std::runtime_error("MappedFile Error: Could not stat file: " + filepath);
+        }
+        length = static_cast<size_t>(st.st_size);
+        if (length > 0) { // Empty files can not be mapped
+            const int protection = copyOnWrite ? (PROT_READ | PROT_WRITE) : PROT_READ;
+            void* addr = ::mmap(nullptr, length, protection, MAP_PRIVATE, fd, 0);
+            if (addr == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("MappedFile Error: Could not map file: " + filepath);
+            }
+            if (sequential) ::madvise(addr, length, MADV_SEQUENTIAL);
+            begin = static_cast<const char*>(addr);
+            mapped = true;
+            writable = copyOnWrite;
+        }
+        ::close(fd); // The mapping keeps its own reference
+    }
+#else
+    MappedFile::MappedFile(const std::string& filepath, bool, bool) {
+        std::ifstream fs(filepath, std::ios_base::binary | std::ios_base::ate);
+        if (!fs) throw std::runtime_error("MappedFile Error: File not found: " + filepath);
+        buffer.resize(static_cast<size_t>(fs.tellg()));
+        fs.seekg(0);
+        fs.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        begin = buffer.data();
+        length = buffer.size();
+        writable = true;
+    }
+#endif
+
+    MappedFile::~MappedFile() { release(); }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept { *this = std::move(other); }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            release();
+            const bool fromBuffer = !other.mapped && other.begin != nullptr;
+            buffer = std::move(other.buffer); // Moving a vector keeps its storage
+            begin = fromBuffer ? buffer.data() : other.begin;
+            length = other.length;
+            mapped = other.mapped;
+            writable = other.writable;
+            other.begin = nullptr;
+            other.length = 0;
+            other.mapped = false;
+            other.writable = false;
+        }
+        return *this;
+    }
+
+    void MappedFile::release() {
+#ifdef ASTRO_HAS_MMAP
+        if (mapped) ::munmap(const_cast<char*>(begin), length);
+#endif
+        begin = nullptr;
+        length = 0;
+        mapped = false;
+        writable = false;
+        buffer.clear();
+    }
+
+}
+}
+}
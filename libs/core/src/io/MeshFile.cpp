@@ -0,0 +1,133 @@
+#include "astro/core/io/MeshFile.hpp"
+#include "astro/core/io/OBJFile.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace astro {
+namespace core {
+namespace io {
+
+static_assert(std::is_trivially_copyable_v<graphics::VertexAttributes>, "VertexAttributes are stored as raw bytes");
+static_assert(MeshFile::ALIGNMENT % alignof(graphics::VertexAttributes) == 0);
+static_assert(sizeof(MeshFile::Header) == 96, "The header layout is part of the file format (bump VERSION)");
+
+namespace {
+    constexpr size_t alignUp(size_t value) { return (value + MeshFile::ALIGNMENT - 1) & ~(MeshFile::ALIGNMENT - 1); }
+
+    void computeBounds(std::span<const graphics::VertexAttributes> vertices, float outMin[3], float outMax[3]) {
+        for (int k = 0; k < 3; ++k) {
+            outMin[k] = vertices.empty() ? 0.0f : std::numeric_limits<float>::max();
+            outMax[k] = vertices.empty() ? 0.0f : std::numeric_limits<float>::lowest();
+        }
+        for (const graphics::VertexAttributes& v : vertices) {
+            for (int k = 0; k < 3; ++k) {
+                outMin[k] = std::min(outMin[k], v.pos[k]);
+                outMax[k] = std::max(outMax[k], v.pos[k]);
+            }
+        }
+    }
+
+    // True if [offset, offset + count * size) is inside a file of 'total' bytes
+    bool fits(uint64_t offset, uint64_t count, uint64_t size, uint64_t total) {
+        return offset <= total && count <= (total - offset) / size;
+    }
+}
+
+    MeshFile::MeshFile(const std::string& filepath) {
+        file.emplace(filepath, false);
+        const char* data = file->data();
+        const size_t size = file->size();
+
+        Header header;
+        if (size < sizeof(Header)) throw std::runtime_error("MeshFile Error: Truncated file: " + filepath);
+        std::memcpy(&header, data, sizeof(Header));
+        if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0)
+            throw std::runtime_error("MeshFile Error: Not an astromesh file: " + filepath);
+        if (header.version != VERSION || header.vertexSize != sizeof(graphics::VertexAttributes))
+            throw std::runtime_error("MeshFile Error: Incompatible version or vertex layout: " + filepath);
+        if (header.vertexOffset % ALIGNMENT != 0 || header.indexOffset % ALIGNMENT != 0 ||
+            !fits(header.vertexOffset, header.vertexCount, sizeof(graphics::VertexAttributes), size) ||
+            !fits(header.indexOffset, header.indexCount, sizeof(uint32_t), size))
+            throw std::runtime_error("MeshFile Error: Truncated file: " + filepath);
+
+        // The mapping is page aligned, so the aligned offsets are valid pointers to the arrays
+        vertexView = {reinterpret_cast<const graphics::VertexAttributes*>(data + header.vertexOffset), header.vertexCount};
+        indexView = {reinterpret_cast<const uint32_t*>(data + header.indexOffset), header.indexCount};
+        minBounds = math::Vec3f(header.boundsMin[0], header.boundsMin[1], header.boundsMin[2]);
+        maxBounds = math::Vec3f(header.boundsMax[0], header.boundsMax[1], header.boundsMax[2]);
+        stamp = header.source;
+    }
+
+    MeshFile::MeshFile(std::vector<graphics::VertexAttributes> vertices, std::vector<uint32_t> indices)
+        : ownedVertices(std::move(vertices)), ownedIndices(std::move(indices)) {
+        vertexView = ownedVertices;
+        indexView = ownedIndices;
+        float lo[3], hi[3];
+        computeBounds(vertexView, lo, hi);
+        minBounds = math::Vec3f(lo[0], lo[1], lo[2]);
+        maxBounds = math::Vec3f(hi[0], hi[1], hi[2]);
+    }
+
+    void MeshFile::write(const std::string& filepath, std::span<const graphics::VertexAttributes> vertices,
+                         std::span<const uint32_t> indices, const FileStamp& source) {
+        Header header{};
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+        header.vertexSize = sizeof(graphics::VertexAttributes);
+        header.vertexCount = vertices.size();
+        header.indexCount = indices.size();
+        header.vertexOffset = alignUp(sizeof(Header));
+        header.indexOffset = alignUp(header.vertexOffset + vertices.size_bytes());
+        header.source = source;
+        computeBounds(vertices, header.boundsMin, header.boundsMax);
+
+        writeFileAtomically(filepath, [&](std::ostream& fs) {
+            const char padding[ALIGNMENT] = {};
+            fs.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+            fs.write(padding, static_cast<std::streamsize>(header.vertexOffset - sizeof(Header)));
+            fs.write(reinterpret_cast<const char*>(vertices.data()), static_cast<std::streamsize>(vertices.size_bytes()));
+            fs.write(padding, static_cast<std::streamsize>(header.indexOffset - header.vertexOffset - vertices.size_bytes()));
+            fs.write(reinterpret_cast<const char*>(indices.data()), static_cast<std::streamsize>(indices.size_bytes()));
+        });
+    }
+
+    std::string MeshFile::cachePath(const std::string& objPath) {
+        return std::filesystem::path(objPath).replace_extension(".astromesh").string();
+    }
+
+    MeshFile MeshFile::loadOBJ(const std::string& objPath, unsigned threads) {
+        FileStamp source = FileStamp::quick(objPath);
+        const std::string cache = cachePath(objPath);
+
+        // 1. Valid cache: same size and mtime, or same content after a touch/checkout
+        if (std::filesystem::exists(cache)) {
+            try {
+                MeshFile mesh(cache);
+                if (FileStamp::validateCache(objPath, source, cache, offsetof(Header, source), mesh.stamp)) return mesh;
+            } catch (std::runtime_error& e) {
+                std::cerr << "MeshFile Warning: Rebuilding invalid cache (" << e.what() << ")." << std::endl;
+            }
+        }
+
+        // 2. Parse the OBJ and rebuild the cache
+        OBJFile obj(objPath, threads);
+        if (source.hash == 0) source = FileStamp::of(objPath);
+        try {
+            write(cache, obj.vertices, obj.indices, source);
+            return MeshFile(cache);
+        } catch (std::runtime_error& e) {
+            std::cerr << "MeshFile Warning: " << e.what() << ", using the parsed mesh." << std::endl;
+            return MeshFile(std::move(obj.vertices), std::move(obj.indices));
+        }
+    }
+
+}
+}
+}
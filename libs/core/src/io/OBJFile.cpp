@@ -0,0 +1,505 @@
+#include "astro/core/io/OBJFile.hpp"
+#include "astro/core/io/MappedFile.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+namespace astro {
+namespace core {
+namespace io {
+
+namespace {
+    // Smallest chunk worth a thread
+    constexpr size_t MIN_CHUNK_BYTES = 1 << 20;
+
+    // Whitespace inside a line ('\r' ends Windows lines)
+    inline bool isBlank(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+    inline void skipBlanks(const char*& p, const char* end) {
+        while (p < end && isBlank(*p)) ++p;
+    }
+
+    inline bool parseFloat(const char*& p, const char* end, float& out) {
+        skipBlanks(p, end);
+        if (p < end && *p == '+') ++p; // from_chars does not accept a leading '+'
+        const auto [ptr, ec] = std::from_chars(p, end, out);
+        if (ec != std::errc()) return false;
+        p = ptr;
+        return true;
+    }
+
+    inline bool parseInt(const char*& p, const char* end, int& out) {
+        const auto [ptr, ec] = std::from_chars(p, end, out);
+        if (ec != std::errc()) return false;
+        p = ptr;
+        return true;
+    }
+
+    enum class LineType { Position, Texcoord, Normal, Face, Other };
+
+    /**
+     * @brief Reads the statement keyword and moves p past it
+     */
+    inline LineType classify(const char*& p, const char* lineEnd) {
+        skipBlanks(p, lineEnd);
+        const size_t length = static_cast<size_t>(lineEnd - p);
+        if (length >= 2 && p[0] == 'v' && isBlank(p[1])) { p += 1; return LineType::Position; }
+        if (length >= 3 && p[0] == 'v' && p[1] == 't' && isBlank(p[2])) { p += 2; return LineType::Texcoord; }
+        if (length >= 3 && p[0] == 'v' && p[1] == 'n' && isBlank(p[2])) { p += 2; return LineType::Normal; }
+        if (length >= 2 && p[0] == 'f' && isBlank(p[1])) { p += 1; return LineType::Face; }
+        return LineType::Other;
+    }
+
+    inline const char* findLineEnd(const char* p, const char* end) {
+        const char* lineEnd = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+        return (lineEnd == nullptr) ? end : lineEnd;
+    }
+
+    /**
+     * @brief Runs fn(i) for i in [0, count), one thread each (i = 0 on the calling thread).
+     * Exceptions are rethrown after every task finished, the lowest i first.
+     */
+    template<typename F>
+    void parallelFor(size_t count, const F& fn) {
+        if (count == 1) { fn(size_t(0)); return; }
+        std::vector<std::exception_ptr> errors(count);
+        std::vector<std::thread> workers;
+        workers.reserve(count - 1);
+        for (size_t i = 1; i < count; ++i) {
+            workers.emplace_back([&fn, &errors, i] {
+                try { fn(i); } catch (...) { errors[i] = std::current_exception(); }
+            });
+        }
+        try { fn(size_t(0)); } catch (...) { errors[0] = std::current_exception(); }
+        for (std::thread& worker : workers) worker.join();
+        for (const std::exception_ptr& error : errors)
+            if (error) std::rethrow_exception(error);
+    }
+
+    // [begin, end) of part i when n items are split in 'parts'
+    inline size_t splitPoint(size_t n, size_t parts, size_t i) { return n * i / parts; }
+
+    inline uint64_t hashCorner(int v, int vt, int vn) {
+        uint64_t h = static_cast<uint32_t>(v) * 0x9E3779B97F4A7C15ull;
+        h ^= static_cast<uint32_t>(vt) * 0xC2B2AE3D27D4EB4Full;
+        h ^= static_cast<uint32_t>(vn) * 0x165667B19E3779F9ull;
+        return h ^ (h >> 29);
+    }
+
+    /**
+     * @brief Open addressing (linear probing) map from a {position, texcoord, normal} triple
+     * to a value. OBJ indices are 1-based, so position 0 marks an empty slot.
+     */
+    class VertexCache {
+    public:
+        explicit VertexCache(size_t expected = 0) { reserve(expected); }
+
+        void reserve(size_t expected) {
+            size_t capacity = 64;
+            while (capacity < expected * 2) capacity <<= 1; // Load factor <= 0.5
+            if (capacity > slots.size()) rehash(capacity);
+        }
+
+        /**
+         * @brief Value of the key, inserting 'next' if it is missing
+         * @return uint32_t stored value
+         */
+        uint32_t findOrInsert(int v, int vt, int vn, uint64_t hash, uint32_t next) {
+            if ((count + 1) * 2 > slots.size()) rehash(slots.size() * 2);
+            for (size_t i = hash & mask;; i = (i + 1) & mask) {
+                Slot& slot = slots[i];
+                if (slot.v == 0) {
+                    slot = {v, vt, vn, next};
+                    ++count;
+                    return next;
+                }
+                if (slot.v == v && slot.vt == vt && slot.vn == vn) return slot.value;
+            }
+        }
+
+    private:
+        struct Slot { int v, vt, vn; uint32_t value; };
+        std::vector<Slot> slots;
+        size_t mask = 0;
+        size_t count = 0;
+
+        void rehash(size_t capacity) {
+            std::vector<Slot> old = std::move(slots);
+            slots.assign(capacity, Slot{0, 0, 0, 0});
+            mask = capacity - 1;
+            for (const Slot& slot : old) {
+                if (slot.v == 0) continue;
+                size_t i = hashCorner(slot.v, slot.vt, slot.vn) & mask;
+                while (slots[i].v != 0) i = (i + 1) & mask;
+                slots[i] = slot;
+            }
+        }
+    };
+
+    struct Corner { int v, vt, vn; };
+
+    /**
+     * @brief Line-aligned part of the file. The counting pass fills the counts, the
+     * prefix sums give the offsets of the chunk in the global arrays.
+     */
+    struct Chunk {
+        const char* begin = nullptr;
+        const char* end = nullptr;
+
+        // Counting pass
+        size_t lines = 0, positions = 0, texcoords = 0, normals = 0;
+        // Global offsets (prefix sums of the previous chunks)
+        size_t lineBase = 0, positionBase = 0, texcoordBase = 0, normalBase = 0;
+
+        // Parsing pass
+        std::vector<Corner> corners;       // Resolved global 1-based indices
+        std::vector<uint32_t> faceSizes;   // Corners per face
+        size_t triangles = 0, degenerateFaces = 0;
+        size_t cornerBase = 0, triangleBase = 0;
+
+        // Deduplication
+        std::vector<std::vector<uint32_t>> shardCorners; // Global corner ordinals per shard
+        size_t firstCorners = 0, vertexBase = 0;
+    };
+
+    /**
+     * @brief Resolves a relative (negative) OBJ index against the elements defined so far
+     * @return int 1-based index, 0 if the element is missing (only for an omitted index: a
+     * relative index reaching before the first element throws)
+     */
+    inline int resolveIndex(int idx, size_t defined, size_t line) {
+        const bool relative = idx < 0;
+        if (relative) idx += static_cast<int>(defined) + 1;
+        if (idx < 0 || (relative && idx == 0) || static_cast<size_t>(idx) > defined)
+            throw std::runtime_error("OBJFile Error: Face index out of range at line " + std::to_string(line));
+        return idx;
+    }
+
+    void countChunk(Chunk& chunk) {
+        for (const char* p = chunk.begin; p < chunk.end;) {
+            const char* lineEnd = findLineEnd(p, chunk.end);
+            ++chunk.lines;
+            switch (classify(p, lineEnd)) {
+                case LineType::Position: ++chunk.positions; break;
+                case LineType::Texcoord: ++chunk.texcoords; break;
+                case LineType::Normal:   ++chunk.normals; break;
+                default: break;
+            }
+            p = lineEnd + 1;
+        }
+    }
+
+    void parseChunk(Chunk& chunk, math::Vec3f* positions, math::Vec2f* texcoords, math::Vec3f* normals) {
+        size_t line = chunk.lineBase;
+        size_t position = chunk.positionBase, texcoord = chunk.texcoordBase, normal = chunk.normalBase;
+        for (const char* p = chunk.begin; p < chunk.end;) {
+            const char* lineEnd = findLineEnd(p, chunk.end);
+            ++line;
+
+            switch (classify(p, lineEnd)) {
+                case LineType::Position: {
+                    math::Vec3f& v = positions[position++];
+                    v = math::Vec3f(0.0f);
+                    if (!parseFloat(p, lineEnd, v.x) || !parseFloat(p, lineEnd, v.y) || !parseFloat(p, lineEnd, v.z))
+                        std::cerr << "OBJFile Warning: Malformed position at line " << line << "." << std::endl;
+                    break;
+                }
+                case LineType::Texcoord: {
+                    math::Vec2f& vt = texcoords[texcoord++];
+                    vt = math::Vec2f(0.0f);
+                    if (!parseFloat(p, lineEnd, vt.x) || !parseFloat(p, lineEnd, vt.y))
+                        std::cerr << "OBJFile Warning: Malformed texcoord at line " << line << "." << std::endl;
+                    break;
+                }
+                case LineType::Normal: {
+                    math::Vec3f& vn = normals[normal++];
+                    vn = math::Vec3f(0.0f);
+                    if (!parseFloat(p, lineEnd, vn.x) || !parseFloat(p, lineEnd, vn.y) || !parseFloat(p, lineEnd, vn.z))
+                        std::cerr << "OBJFile Warning: Malformed normal at line " << line << "." << std::endl;
+                    break;
+                }
+                case LineType::Face: {
+                    // Corners: v, v/vt, v//vn or v/vt/vn
+                    uint32_t size = 0;
+                    while (true) {
+                        skipBlanks(p, lineEnd);
+                        if (p >= lineEnd) break;
+                        int v = 0, vt = 0, vn = 0;
+                        bool valid = parseInt(p, lineEnd, v);
+                        if (valid && p < lineEnd && *p == '/') {
+                            ++p;
+                            if (p < lineEnd && *p != '/') valid = parseInt(p, lineEnd, vt);
+                            if (valid && p < lineEnd && *p == '/') {
+                                ++p;
+                                valid = parseInt(p, lineEnd, vn);
+                            }
+                        }
+                        if (!valid || v == 0 || (p < lineEnd && !isBlank(*p)))
+                            throw std::runtime_error("OBJFile Error: Malformed face at line " + std::to_string(line));
+
+                        chunk.corners.push_back({resolveIndex(v, position, line), resolveIndex(vt, texcoord, line), resolveIndex(vn, normal, line)});
+                        ++size;
+                    }
+                    chunk.faceSizes.push_back(size);
+                    if (size >= 3) chunk.triangles += size - 2;
+                    else ++chunk.degenerateFaces;
+                    break;
+                }
+                default: break;
+            }
+            p = lineEnd + 1;
+        }
+    }
+}
+
+    void OBJFile::loadFromFile(const std::string& filepath, unsigned threads) {
+        const MappedFile file(filepath);
+        loadFromMemory(file.data(), file.size(), threads);
+    }
+
+    void OBJFile::loadFromMemory(const char* data, size_t size, unsigned threads) {
+        vertices.clear();
+        indices.clear();
+
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+        const size_t chunkCount = std::clamp<size_t>(size / MIN_CHUNK_BYTES, 1, threads);
+
+        // 1. Line-aligned chunks, counted in parallel so every chunk knows where its
+        // elements go in the global arrays and how many were defined before it
+        std::vector<Chunk> chunks(chunkCount);
+        const char* const end = data + size;
+        const char* chunkBegin = data;
+        for (size_t i = 0; i < chunkCount; ++i) {
+            const char* chunkEnd = (i + 1 == chunkCount) ? end : std::max(chunkBegin, data + splitPoint(size, chunkCount, i + 1));
+            if (chunkEnd < end) {
+                chunkEnd = findLineEnd(chunkEnd, end);
+                if (chunkEnd < end) ++chunkEnd; // Keep the '\n' in this chunk
+            }
+            chunks[i].begin = chunkBegin;
+            chunks[i].end = chunkEnd;
+            chunkBegin = chunks[i].end;
+        }
+        parallelFor(chunkCount, [&](size_t i) { countChunk(chunks[i]); });
+
+        size_t positionCount = 0, texcoordCount = 0, normalCount = 0, lineCount = 0;
+        for (Chunk& chunk : chunks) {
+            chunk.lineBase = lineCount;         lineCount += chunk.lines;
+            chunk.positionBase = positionCount; positionCount += chunk.positions;
+            chunk.texcoordBase = texcoordCount; texcoordCount += chunk.texcoords;
+            chunk.normalBase = normalCount;     normalCount += chunk.normals;
+        }
+
+        // 2. Parse: elements straight into the global arrays, face corners resolved to global indices
+        std::vector<math::Vec3f> temp_positions(positionCount);
+        std::vector<math::Vec2f> temp_texcoords(texcoordCount);
+        std::vector<math::Vec3f> temp_normals(normalCount);
+        parallelFor(chunkCount, [&](size_t i) {
+            parseChunk(chunks[i], temp_positions.data(), temp_texcoords.data(), temp_normals.data());
+        });
+
+        size_t cornerCount = 0, triangleCount = 0, degenerateFaces = 0;
+        for (Chunk& chunk : chunks) {
+            chunk.cornerBase = cornerCount;     cornerCount += chunk.corners.size();
+            chunk.triangleBase = triangleCount; triangleCount += chunk.triangles;
+            degenerateFaces += chunk.degenerateFaces;
+        }
+        if (degenerateFaces > 0)
+            std::cerr << "OBJFile Warning: Skipping " << degenerateFaces << " degenerate faces with less than 3 vertices." << std::endl;
+        if (cornerCount > UINT32_MAX) throw std::runtime_error("OBJFile Error: Too many face corners");
+
+        // 3. Deduplication. Corners are sharded by hash, every shard keeps the first ordinal of
+        // each key, so the vertex order (first occurrence) does not depend on the thread count
+        const size_t shardCount = chunkCount;
+        auto shardOf = [shardCount](uint64_t hash) { return static_cast<size_t>((hash >> 40) % shardCount); };
+        if (shardCount > 1) {
+            parallelFor(chunkCount, [&](size_t i) {
+                Chunk& chunk = chunks[i];
+                chunk.shardCorners.assign(shardCount, {});
+                for (auto& list : chunk.shardCorners) list.reserve(chunk.corners.size() / shardCount + 16);
+                for (size_t c = 0; c < chunk.corners.size(); ++c) {
+                    const Corner& k = chunk.corners[c];
+                    chunk.shardCorners[shardOf(hashCorner(k.v, k.vt, k.vn))].push_back(static_cast<uint32_t>(chunk.cornerBase + c));
+                }
+            });
+        }
+
+        // Corner ordinal -> chunk and local index
+        auto cornerAt = [&](uint32_t ordinal) -> const Corner& {
+            const auto it = std::upper_bound(chunks.begin(), chunks.end(), ordinal,
+                [](uint32_t o, const Chunk& chunk) { return o < chunk.cornerBase; });
+            const Chunk& chunk = *(it - 1);
+            return chunk.corners[ordinal - chunk.cornerBase];
+        };
+
+        std::vector<uint32_t> firstCorner(cornerCount); // Ordinal of the first corner with the same key
+        parallelFor(shardCount, [&](size_t s) {
+            VertexCache cache;
+            auto visit = [&](uint32_t ordinal, const Corner& k) {
+                firstCorner[ordinal] = cache.findOrInsert(k.v, k.vt, k.vn, hashCorner(k.v, k.vt, k.vn), ordinal);
+            };
+            if (shardCount == 1) {
+                cache.reserve(positionCount); // Most meshes have about as many vertices as positions
+                for (const Chunk& chunk : chunks)
+                    for (size_t c = 0; c < chunk.corners.size(); ++c) visit(static_cast<uint32_t>(chunk.cornerBase + c), chunk.corners[c]);
+            } else {
+                size_t expected = 0;
+                for (const Chunk& chunk : chunks) expected += chunk.shardCorners[s].size();
+                cache.reserve(std::min(expected, positionCount / shardCount + 64));
+                for (const Chunk& chunk : chunks)
+                    for (const uint32_t ordinal : chunk.shardCorners[s]) visit(ordinal, cornerAt(ordinal));
+            }
+        });
+
+        // 4. Vertex indices: first occurrences are numbered in corner order
+        std::vector<uint32_t> cornerVertex(cornerCount);
+        parallelFor(chunkCount, [&](size_t i) {
+            Chunk& chunk = chunks[i];
+            chunk.shardCorners.clear();
+            for (size_t c = 0; c < chunk.corners.size(); ++c)
+                if (firstCorner[chunk.cornerBase + c] == chunk.cornerBase + c) ++chunk.firstCorners;
+        });
+        size_t vertexCount = 0;
+        for (Chunk& chunk : chunks) { chunk.vertexBase = vertexCount; vertexCount += chunk.firstCorners; }
+
+        vertices.resize(vertexCount);
+        parallelFor(chunkCount, [&](size_t i) {
+            const Chunk& chunk = chunks[i];
+            uint32_t next = static_cast<uint32_t>(chunk.vertexBase);
+            for (size_t c = 0; c < chunk.corners.size(); ++c) {
+                const size_t ordinal = chunk.cornerBase + c;
+                if (firstCorner[ordinal] != ordinal) continue;
+                const Corner& k = chunk.corners[c];
+                graphics::VertexAttributes& attr = vertices[next];
+                attr.pos = math::Vec4f(temp_positions[k.v - 1], 1.0f);
+                attr.uv = (k.vt > 0) ? temp_texcoords[k.vt - 1] : math::Vec2f(0.0f);
+                attr.normal = (k.vn > 0) ? temp_normals[k.vn - 1] : math::Vec3f(0.0f);
+                cornerVertex[ordinal] = next++;
+            }
+        });
+
+        // 5. Triangulation (Fan-style)
+        // This handles quads and n-gons exported by Blender/Maya
+        indices.resize(triangleCount * 3);
+        parallelFor(chunkCount, [&](size_t i) {
+            const Chunk& chunk = chunks[i];
+            auto vertexOf = [&](size_t c) {
+                const size_t ordinal = chunk.cornerBase + c;
+                return cornerVertex[firstCorner[ordinal]]; // Earlier chunks are already numbered
+            };
+            uint32_t* out = indices.data() + chunk.triangleBase * 3;
+            size_t c = 0;
+            for (const uint32_t faceSize : chunk.faceSizes) {
+                for (uint32_t k = 1; k + 1 < faceSize; ++k) {
+                    *out++ = vertexOf(c);
+                    *out++ = vertexOf(c + k);
+                    *out++ = vertexOf(c + k + 1);
+                }
+                c += faceSize;
+            }
+        });
+
+        computeTangents(static_cast<unsigned>(chunkCount));
+    }
+
+    void OBJFile::computeTangents(unsigned threads) {
+        threads = std::max(threads, 1u);
+        const size_t triangleCount = indices.size() / 3;
+        const size_t vertexCount = vertices.size();
+
+        // Every thread owns a vertex range for the accumulation
+        std::vector<uint32_t> vertexBounds(threads + 1);
+        for (unsigned part = 0; part <= threads; ++part)
+            vertexBounds[part] = static_cast<uint32_t>(splitPoint(vertexCount, threads, part));
+
+        // Per triangle tangents in parallel. Each thread also buckets the corners of its triangles
+        // by the thread owning their vertex, so the accumulation reads every corner once (a single
+        // thread adds them to the vertices right away)
+        struct CornerRef {
+            uint32_t vertex;
+            uint32_t triangle;
+        };
+        std::vector<math::Vec3f> triangleTangents(triangleCount);
+        std::vector<std::vector<CornerRef>> buckets(static_cast<size_t>(threads) * threads); // [triangle part][vertex part]
+        parallelFor(threads, [&](size_t part) {
+            std::vector<CornerRef>* out = buckets.data() + part * threads;
+            const size_t firstTriangle = splitPoint(triangleCount, threads, part);
+            const size_t lastTriangle = splitPoint(triangleCount, threads, part + 1);
+            if (threads > 1) {
+                for (unsigned owner = 0; owner < threads; ++owner) out[owner].reserve((lastTriangle - firstTriangle) * 3 / threads);
+            }
+            for (size_t t = firstTriangle; t < lastTriangle; ++t) {
+                const graphics::VertexAttributes& v0 = vertices[indices[t * 3]];
+                const graphics::VertexAttributes& v1 = vertices[indices[t * 3 + 1]];
+                const graphics::VertexAttributes& v2 = vertices[indices[t * 3 + 2]];
+
+                math::Vec3f edge1 = (v1.pos - v0.pos).xyz;
+                math::Vec3f edge2 = (v2.pos - v0.pos).xyz;
+
+                math::Vec2f deltaUV1 = v1.uv - v0.uv;
+                math::Vec2f deltaUV2 = v2.uv - v0.uv;
+
+                float det = (deltaUV1.x * deltaUV2.y - deltaUV2.x * deltaUV1.y);
+                math::Vec3f tangent;
+
+                if (std::abs(det) < 1e-6f) {
+                    // Degenerate UVs, use a default tangent based on the first edge
+                    tangent = (math::len(edge1) > 0.0f) ? math::normalize(edge1) : math::Vec3f(0.0f);
+                } else {
+                    float f = 1.0f / det;
+                    tangent.x = f * (deltaUV2.y * edge1.x - deltaUV1.y * edge2.x);
+                    tangent.y = f * (deltaUV2.y * edge1.y - deltaUV1.y * edge2.y);
+                    tangent.z = f * (deltaUV2.y * edge1.z - deltaUV1.y * edge2.z);
+                    tangent = (math::len(tangent) > 0.0f) ? math::normalize(tangent) : math::Vec3f(0.0f);
+                }
+                triangleTangents[t] = tangent;
+
+                for (size_t k = t * 3; k < t * 3 + 3; ++k) {
+                    const uint32_t v = indices[k];
+                    if (threads == 1) {
+                        vertices[v].tangent = vertices[v].tangent + tangent; // Same order as the buckets
+                        continue;
+                    }
+                    const size_t owner = std::upper_bound(vertexBounds.begin(), vertexBounds.end(), v) - vertexBounds.begin() - 1;
+                    out[owner].push_back({v, static_cast<uint32_t>(t)});
+                }
+            }
+        });
+
+        // Accumulate into the vertices (for smoothing). Every thread adds the corners of its vertex
+        // range in triangle order, so there are no races and the sums do not depend on the thread count
+        parallelFor(threads, [&](size_t part) {
+            const uint32_t first = vertexBounds[part];
+            const uint32_t last = vertexBounds[part + 1];
+            for (unsigned source = 0; source < threads; ++source) {
+                for (const CornerRef& corner : buckets[source * threads + part]) {
+                    vertices[corner.vertex].tangent = vertices[corner.vertex].tangent + triangleTangents[corner.triangle];
+                }
+            }
+
+            // Re-normalize and Orthonormalize (Gram-Schmidt)
+            for (uint32_t i = first; i < last; ++i) {
+                graphics::VertexAttributes& v = vertices[i];
+                if (math::len(v.tangent) > 0.0001f) {
+                    v.tangent = math::normalize(v.tangent);
+
+                    // Gram-Schmidt: Ensure tangent is perfectly orthogonal to the normal
+                    // T = normalize(T - N * dot(N, T))
+                    const math::Vec3f orthogonal = v.tangent - v.normal * math::dot(v.normal, v.tangent);
+                    if (math::len(orthogonal) > 0.0001f) v.tangent = math::normalize(orthogonal);
+                } else {
+                    // Fallback if tangent is zero (e.g. no UVs provided)
+                    v.tangent = math::Vec3f(1, 0, 0);
+                }
+            }
+        });
+    }
+
+}
+}
+}
@@ -0,0 +1,113 @@
+#include "astro/core/io/PPMImage.hpp"
+#include "astro/core/io/MappedFile.hpp"
+#include "PixelRows.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+namespace astro {
+namespace core {
+namespace io {
+
+namespace {
+    constexpr size_t WRITE_BLOCK_BYTES = 1 << 20; // Rows packed per write
+
+    inline bool isSpace(uint8_t c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f'; }
+
+    // Skips whitespace and comments ('#' up to the end of the line) between header fields
+    void skipSeparators(const uint8_t*& p, const uint8_t* end) {
+        while (p < end) {
+            if (isSpace(*p)) ++p;
+            else if (*p == '#') { while (p < end && *p != '\n') ++p; }
+            else break;
+        }
+    }
+
+    int readHeaderInt(const uint8_t*& p, const uint8_t* end) {
+        skipSeparators(p, end);
+        int value = 0;
+        const auto [ptr, ec] = std::from_chars(reinterpret_cast<const char*>(p), reinterpret_cast<const char*>(end), value);
+        if (ec != std::errc() || value <= 0) throw std::runtime_error("PPMImage Error: Invalid header.");
+        p = reinterpret_cast<const uint8_t*>(ptr);
+        return value;
+    }
+}
+
+    void PPMImage::writeImage(const std::string& path, const graphics::Texture& image) {
+        std::filesystem::path out_path = path;
+
+        if (out_path.extension().compare(".ppm") != 0) {
+            std::string error = "PPMImage extension should be '.ppm', not '" + out_path.extension().string() + "'.";
+            throw std::runtime_error( error );
+        }
+        if (!std::filesystem::exists(out_path.parent_path())) {
+            std::string error = "PPMImage output path does not exist: '" + out_path.parent_path().string() + "'.";
+            throw std::runtime_error( error );
+        }
+        if (std::filesystem::exists(out_path))
+            std::cout << "PPMImage Warning: overriding existing PPM Image.\n";
+
+        // Open for truncating
+        std::ofstream fs(out_path, std::ios_base::trunc | std::ios_base::binary);
+        fs << magic_number << ' ' << image.width << ' ' << image.height << ' ';
+        fs << 255 << '\n'; // Max colo val
+
+        // Pixels: blocks of whole rows packed to RGB, one write per block
+        const detail::PackRowFn packRow = detail::selectPackRow24<0, 1, 2>();
+        const size_t rowBytes = static_cast<size_t>(image.width) * 3;
+        const int blockRows = static_cast<int>(std::max<size_t>(1, WRITE_BLOCK_BYTES / std::max<size_t>(rowBytes, 1)));
+        std::vector<uint8_t> buffer(rowBytes * std::min(blockRows, image.height));
+
+        for (int y0 = 0; y0 < image.height; y0 += blockRows) {
+            const int rows = std::min(blockRows, image.height - y0);
+            for (int r = 0; r < rows; ++r)
+                packRow(image.data.data() + image.index(0, y0 + r), buffer.data() + r * rowBytes, image.width);
+            fs.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(rows * rowBytes));
+        }
+
+        if (!fs.flush()) throw std::runtime_error("PPMImage Error: Could not write file: " + path);
+    }
+
+    graphics::Texture PPMImage::readImage(const std::string& path) {
+        if (!std::filesystem::exists(path)) {
+            throw std::runtime_error("PPMImage Error: File not found: " + path);
+        }
+        const MappedFile file(path);
+        return readImageFromMemory(reinterpret_cast<const uint8_t*>(file.data()), file.size());
+    }
+
+    graphics::Texture PPMImage::readImageFromMemory(const uint8_t* data, size_t size) {
+        const uint8_t* const end = data + size;
+        if (size < 2 || data[0] != magic_number[0] || data[1] != magic_number[1]) {
+            throw std::runtime_error("PPMImage Error: Not a binary (P6) PPM image.");
+        }
+
+        const uint8_t* p = data + 2;
+        const int width = readHeaderInt(p, end);
+        const int height = readHeaderInt(p, end);
+        const int maxValue = readHeaderInt(p, end);
+        if (maxValue != 255) {
+            throw std::runtime_error("PPMImage Error: Only 8-bit images (max value 255) are supported.");
+        }
+        // A single whitespace separates the header from the pixels
+        if (p == end || !isSpace(*p)) throw std::runtime_error("PPMImage Error: Invalid header.");
+        ++p;
+
+        const size_t pixels = static_cast<size_t>(width) * height;
+        if (static_cast<size_t>(end - p) / 3 < pixels) {
+            throw std::runtime_error("PPMImage Error: Unexpected end of pixel data.");
+        }
+
+        graphics::Texture image(width, height);
+        detail::selectExpandRow24<0, 1, 2>()(p, image.data.data(), pixels);
+        return image;
+    }
+
+}
+}
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+// Row conversions between packed 24-bit pixels and RGBA Colors, shared by the image codecs.
+// x86 SIMD kernels are compiled per-function and selected at runtime.
+
+#include <cstddef>
+#include <cstdint>
+
+#include "astro/graphics/graphics.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define ASTRO_IO_SIMD_X86
+    #include <immintrin.h>
+#endif
+
+namespace astro {
+namespace core {
+namespace io {
+namespace detail {
+
+static_assert(sizeof(graphics::Color) == 4, "Pixel kernels expect tightly packed RGBA colors");
+
+// 'count' 3-byte pixels to RGBA (alpha 255)
+using ExpandRowFn = void (*)(const uint8_t* src, graphics::Color* dst, size_t count);
+// 'count' RGBA pixels to 3 bytes each
+using PackRowFn = void (*)(const graphics::Color* src, uint8_t* dst, size_t count);
+
+// --- Scalar kernels -------------------------------
+// RGBA byte k is taken from source byte Pk
+template <int P0, int P1, int P2>
+inline void expandRow24Scalar(const uint8_t* src, graphics::Color* dst, size_t count) {
+    uint8_t* d = reinterpret_cast<uint8_t*>(dst);
+    for (size_t x = 0; x < count; ++x, src += 3, d += 4) {
+        d[0] = src[P0]; d[1] = src[P1]; d[2] = src[P2]; d[3] = 255;
+    }
+}
+// Destination byte k is taken from RGBA byte Pk
+template <int P0, int P1, int P2>
+inline void packRow24Scalar(const graphics::Color* src, uint8_t* dst, size_t count) {
+    const uint8_t* s = reinterpret_cast<const uint8_t*>(src);
+    for (size_t x = 0; x < count; ++x, s += 4, dst += 3) {
+        dst[0] = s[P0]; dst[1] = s[P1]; dst[2] = s[P2];
+    }
+}
+
+#ifdef ASTRO_IO_SIMD_X86
+// --- SSSE3 kernels --------------------------------
+template <int P0, int P1, int P2>
+__attribute__((target("ssse3")))
+inline void expandRow24SSSE3(const uint8_t* src, graphics::Color* dst, size_t count) {
+    // 4 pixels from the low 12 bytes, alpha bytes zeroed then set to 255
+    const __m128i mask = _mm_setr_epi8(
+        P0, P1, P2, -1,  P0 + 3, P1 + 3, P2 + 3, -1,  P0 + 6, P1 + 6, P2 + 6, -1,  P0 + 9, P1 + 9, P2 + 9, -1);
+    const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+    __m128i* d = reinterpret_cast<__m128i*>(dst);
+
+    // Every load reads 16 bytes for 12 used: stop while 4 more bytes are still in the input
+    size_t x = 0;
+    for (; x + 18 <= count; x += 16, src += 48, d += 4) {
+        const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 0));
+        const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 12));
+        const __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 24));
+        const __m128i v3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 36));
+        _mm_storeu_si128(d + 0, _mm_or_si128(_mm_shuffle_epi8(v0, mask), alpha));
+        _mm_storeu_si128(d + 1, _mm_or_si128(_mm_shuffle_epi8(v1, mask), alpha));
+        _mm_storeu_si128(d + 2, _mm_or_si128(_mm_shuffle_epi8(v2, mask), alpha));
+        _mm_storeu_si128(d + 3, _mm_or_si128(_mm_shuffle_epi8(v3, mask), alpha));
+    }
+    for (; x + 6 <= count; x += 4, src += 12, ++d) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        _mm_storeu_si128(d, _mm_or_si128(_mm_shuffle_epi8(v, mask), alpha));
+    }
+    expandRow24Scalar<P0, P1, P2>(src, dst + x, count - x);
+}
+
+template <int P0, int P1, int P2>
+__attribute__((target("ssse3")))
+inline void packRow24SSSE3(const graphics::Color* src, uint8_t* dst, size_t count) {
+    // Packs 4 pixels into the low 12 bytes, upper 4 bytes are zeroed
+    const __m128i mask = _mm_setr_epi8(
+        P0, P1, P2,  P0 + 4, P1 + 4, P2 + 4,  P0 + 8, P1 + 8, P2 + 8,  P0 + 12, P1 + 12, P2 + 12,
+        -1, -1, -1, -1);
+    const __m128i* s = reinterpret_cast<const __m128i*>(src);
+    __m128i* d = reinterpret_cast<__m128i*>(dst);
+
+    // 16 pixels (48 bytes) per iteration, stitched into 3 full stores
+    size_t x = 0;
+    for (; x + 16 <= count; x += 16, s += 4, d += 3) {
+        const __m128i a = _mm_shuffle_epi8(_mm_loadu_si128(s + 0), mask);
+        const __m128i b = _mm_shuffle_epi8(_mm_loadu_si128(s + 1), mask);
+        const __m128i c = _mm_shuffle_epi8(_mm_loadu_si128(s + 2), mask);
+        const __m128i e = _mm_shuffle_epi8(_mm_loadu_si128(s + 3), mask);
+        _mm_storeu_si128(d + 0, _mm_or_si128(a, _mm_slli_si128(b, 12)));
+        _mm_storeu_si128(d + 1, _mm_or_si128(_mm_srli_si128(b, 4), _mm_slli_si128(c, 8)));
+        _mm_storeu_si128(d + 2, _mm_or_si128(_mm_srli_si128(c, 8), _mm_slli_si128(e, 4)));
+    }
+    packRow24Scalar<P0, P1, P2>(src + x, dst + x * 3, count - x);
+}
+#endif
+
+template <int P0, int P1, int P2>
+inline ExpandRowFn selectExpandRow24() {
+#ifdef ASTRO_IO_SIMD_X86
+    if (__builtin_cpu_supports("ssse3")) return expandRow24SSSE3<P0, P1, P2>;
+#endif
+    return expandRow24Scalar<P0, P1, P2>;
+}
+
+template <int P0, int P1, int P2>
+inline PackRowFn selectPackRow24() {
+#ifdef ASTRO_IO_SIMD_X86
+    if (__builtin_cpu_supports("ssse3")) return packRow24SSSE3<P0, P1, P2>;
+#endif
+    return packRow24Scalar<P0, P1, P2>;
+}
+
+}
+}
+}
+}
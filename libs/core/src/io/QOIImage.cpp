@@ -0,0 +1,251 @@
+#include "astro/core/io/QOIImage.hpp"
+#include "astro/core/io/MappedFile.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+namespace astro {
+namespace core {
+namespace io {
+
+namespace {
+    constexpr uint8_t OP_INDEX = 0x00; // 00xxxxxx
+    constexpr uint8_t OP_DIFF  = 0x40; // 01xxxxxx
+    constexpr uint8_t OP_LUMA  = 0x80; // 10xxxxxx
+    constexpr uint8_t OP_RUN   = 0xc0; // 11xxxxxx
+    constexpr uint8_t OP_RGB   = 0xfe;
+    constexpr uint8_t OP_RGBA  = 0xff;
+    constexpr int MAX_RUN = 62;
+    constexpr uint8_t END_MARKER[8] = {0, 0, 0, 0, 0, 0, 0, 1};
+
+    static_assert(sizeof(graphics::Color) == 4, "Pixels are handled as 32-bit words");
+
+    // Pixels are kept in 32-bit words holding the RGBA bytes in memory order
+    constexpr uint32_t pack(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+        if constexpr (std::endian::native == std::endian::little)
+            return uint32_t(r) | uint32_t(g) << 8 | uint32_t(b) << 16 | uint32_t(a) << 24;
+        else
+            return uint32_t(r) << 24 | uint32_t(g) << 16 | uint32_t(b) << 8 | uint32_t(a);
+    }
+    constexpr uint32_t RGB_MASK = pack(255, 255, 255, 0);
+    constexpr uint32_t ALPHA_MASK = pack(0, 0, 0, 255);
+
+    inline uint32_t word(const uint8_t* px) {
+        uint32_t v;
+        std::memcpy(&v, px, 4);
+        return v;
+    }
+
+    // (r * 3 + g * 5 + b * 7 + a * 11) % 64
+    inline int hashIndex(uint32_t v) {
+        if constexpr (std::endian::native == std::endian::little) {
+            // Channels spread to 16-bit lanes (r, b, g, a), one multiply sums them in the top lane
+            const uint64_t lanes = ((uint64_t(v) & 0xff00ff00u) << 24) | (uint64_t(v) & 0x00ff00ffu);
+            return static_cast<int>((lanes * (11ull | 5ull << 16 | 7ull << 32 | 3ull << 48)) >> 48) & 63;
+        } else {
+            return static_cast<int>(((v >> 24) * 3 + ((v >> 16) & 255) * 5 + ((v >> 8) & 255) * 7 + (v & 255) * 11) & 63);
+        }
+    }
+
+    // Adds each byte modulo 256 (no carry between channels)
+    inline uint32_t addBytes(uint32_t a, uint32_t b) {
+        return ((a & 0x7f7f7f7fu) + (b & 0x7f7f7f7fu)) ^ ((a ^ b) & 0x80808080u);
+    }
+
+    // Channel deltas of OP_DIFF (by its 6-bit payload) and OP_LUMA (green byte, red/blue byte)
+    struct DeltaTables {
+        uint32_t diff[64];
+        uint32_t lumaG[64];
+        uint32_t lumaRB[256];
+
+        constexpr DeltaTables() : diff(), lumaG(), lumaRB() {
+            for (int i = 0; i < 64; ++i) {
+                diff[i] = pack(uint8_t(((i >> 4) & 3) - 2), uint8_t(((i >> 2) & 3) - 2), uint8_t((i & 3) - 2), 0);
+                const int vg = i - 32;
+                lumaG[i] = pack(uint8_t(vg - 8), uint8_t(vg), uint8_t(vg - 8), 0);
+            }
+            for (int i = 0; i < 256; ++i) lumaRB[i] = pack(uint8_t(i >> 4), 0, uint8_t(i & 15), 0);
+        }
+    };
+    constexpr DeltaTables DELTAS;
+
+    inline void writeBE32(uint8_t* p, uint32_t v) {
+        p[0] = static_cast<uint8_t>(v >> 24); p[1] = static_cast<uint8_t>(v >> 16);
+        p[2] = static_cast<uint8_t>(v >> 8);  p[3] = static_cast<uint8_t>(v);
+    }
+    inline uint32_t readBE32(const uint8_t* p) {
+        return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | uint32_t(p[3]);
+    }
+}
+
+    std::vector<uint8_t> QOIImage::encode(const graphics::Texture& image) {
+        const uint64_t pixels = static_cast<uint64_t>(image.width) * static_cast<uint64_t>(std::max(image.height, 0));
+        if (image.width <= 0 || image.height <= 0 || pixels > QOI_MAX_PIXELS) {
+            throw std::runtime_error("QOIImage Error: Invalid image size.");
+        }
+
+        // Worst case is 5 bytes per pixel, plus the run carried over from the previous row
+        // (flushed by the first pixel) or the last run and the end marker after the last row.
+        // The buffer grows a row at a time instead of zero-filling 5x the image up front
+        const size_t rowWorst = static_cast<size_t>(image.width) * 5 + 1 + QOI_PADDING_SIZE;
+        std::vector<uint8_t> out(QOI_HEADER_SIZE + pixels / 2 + rowWorst);
+        size_t pos = QOI_HEADER_SIZE;
+
+        uint32_t index[64] = {};
+        uint8_t prev[4] = {0, 0, 0, 255};
+        uint32_t prevWord = word(prev);
+        int run = 0;
+        bool opaque = true;
+
+        for (int y = 0; y < image.height; ++y) {
+            if (out.size() < pos + rowWorst) {
+                out.resize(std::max(out.size() * 3 / 2, pos + rowWorst));
+            }
+            uint8_t* o = out.data() + pos;
+            const uint8_t* px = reinterpret_cast<const uint8_t*>(image.data.data() + image.index(0, y));
+            const uint8_t* const rowEnd = px + static_cast<size_t>(image.width) * 4;
+
+            for (; px < rowEnd; px += 4) {
+                const uint32_t v = word(px);
+                if (v == prevWord) {
+                    if (++run == MAX_RUN) {
+                        *o++ = OP_RUN | (MAX_RUN - 1);
+                        run = 0;
+                    }
+                    continue;
+                }
+                if (run > 0) {
+                    *o++ = static_cast<uint8_t>(OP_RUN | (run - 1));
+                    run = 0;
+                }
+
+                const int h = hashIndex(v);
+                if (index[h] == v) {
+                    *o++ = static_cast<uint8_t>(OP_INDEX | h);
+                } else {
+                    index[h] = v;
+                    if (px[3] == prev[3]) {
+                        const int8_t vr = static_cast<int8_t>(px[0] - prev[0]);
+                        const int8_t vg = static_cast<int8_t>(px[1] - prev[1]);
+                        const int8_t vb = static_cast<int8_t>(px[2] - prev[2]);
+                        const int8_t vgr = static_cast<int8_t>(vr - vg);
+                        const int8_t vgb = static_cast<int8_t>(vb - vg);
+                        if (vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2) {
+                            *o++ = static_cast<uint8_t>(OP_DIFF | (vr + 2) << 4 | (vg + 2) << 2 | (vb + 2));
+                        } else if (vgr > -9 && vgr < 8 && vg > -33 && vg < 32 && vgb > -9 && vgb < 8) {
+                            *o++ = static_cast<uint8_t>(OP_LUMA | (vg + 32));
+                            *o++ = static_cast<uint8_t>((vgr + 8) << 4 | (vgb + 8));
+                        } else {
+                            o[0] = OP_RGB; o[1] = px[0]; o[2] = px[1]; o[3] = px[2];
+                            o += 4;
+                        }
+                    } else {
+                        opaque = false;
+                        o[0] = OP_RGBA;
+                        std::memcpy(o + 1, px, 4);
+                        o += 5;
+                    }
+                }
+                std::memcpy(prev, px, 4);
+                prevWord = v;
+            }
+            pos = static_cast<size_t>(o - out.data());
+        }
+        if (run > 0) out[pos++] = static_cast<uint8_t>(OP_RUN | (run - 1));
+        std::memcpy(out.data() + pos, END_MARKER, QOI_PADDING_SIZE);
+        out.resize(pos + QOI_PADDING_SIZE);
+
+        std::memcpy(out.data(), magic_number, 4);
+        writeBE32(out.data() + 4, static_cast<uint32_t>(image.width));
+        writeBE32(out.data() + 8, static_cast<uint32_t>(image.height));
+        out[12] = opaque ? 3 : 4; // Channels
+        out[13] = 0;              // sRGB with linear alpha
+        return out;
+    }
+
+    void QOIImage::writeImage(const std::string& path, const graphics::Texture& image) {
+        const std::vector<uint8_t> bytes = encode(image);
+        std::ofstream fs(path, std::ios_base::binary | std::ios_base::trunc);
+        if (!fs) throw std::runtime_error("QOIImage Error: Could not open file for writing: " + path);
+        fs.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        if (!fs.flush()) throw std::runtime_error("QOIImage Error: Could not write file: " + path);
+    }
+
+    graphics::Texture QOIImage::readImage(const std::string& path) {
+        if (!std::filesystem::exists(path)) {
+            throw std::runtime_error("QOIImage Error: File not found: " + path);
+        }
+        const MappedFile file(path);
+        return readImageFromMemory(reinterpret_cast<const uint8_t*>(file.data()), file.size());
+    }
+
+    graphics::Texture QOIImage::readImageFromMemory(const uint8_t* data, size_t size) {
+        if (size < QOI_HEADER_SIZE + QOI_PADDING_SIZE || std::memcmp(data, magic_number, 4) != 0) {
+            throw std::runtime_error("QOIImage Error: Not a QOI image.");
+        }
+        const uint32_t width = readBE32(data + 4);
+        const uint32_t height = readBE32(data + 8);
+        const uint8_t channels = data[12], colorspace = data[13];
+        if (width == 0 || height == 0 || width > 0x7FFFFFFF || height > 0x7FFFFFFF ||
+            static_cast<uint64_t>(width) * height > QOI_MAX_PIXELS || channels < 3 || channels > 4 || colorspace > 1) {
+            throw std::runtime_error("QOIImage Error: Invalid header.");
+        }
+
+        graphics::Texture image(static_cast<int>(width), static_cast<int>(height));
+        uint8_t* out = reinterpret_cast<uint8_t*>(image.data.data());
+        uint8_t* const outEnd = out + image.data.size() * 4;
+
+        // Every chunk is at most 5 bytes and starts before the 8 padding bytes, so no read
+        // leaves the buffer
+        const uint8_t* p = data + QOI_HEADER_SIZE;
+        const uint8_t* const chunksEnd = data + size - QOI_PADDING_SIZE;
+        uint32_t index[64] = {};
+        uint32_t px = pack(0, 0, 0, 255);
+
+        while (out < outEnd) {
+            if (p >= chunksEnd) throw std::runtime_error("QOIImage Error: Unexpected end of pixel data.");
+            const uint8_t b1 = *p++;
+
+            switch (b1 >> 6) {
+            case OP_INDEX >> 6:
+                px = index[b1];
+                std::memcpy(out, &px, 4);
+                out += 4;
+                continue; // Already in the index
+            case OP_DIFF >> 6:
+                px = addBytes(px, DELTAS.diff[b1 & 0x3f]);
+                break;
+            case OP_LUMA >> 6:
+                px = addBytes(px, addBytes(DELTAS.lumaG[b1 & 0x3f], DELTAS.lumaRB[*p++]));
+                break;
+            default:
+                if (b1 == OP_RGB) {
+                    px = (word(p) & RGB_MASK) | (px & ALPHA_MASK); // The 4th byte read is the next chunk
+                    p += 3;
+                } else if (b1 == OP_RGBA) {
+                    px = word(p);
+                    p += 4;
+                } else { // OP_RUN: repeat the previous pixel
+                    const size_t run = std::min<size_t>((b1 & 0x3f) + 1, static_cast<size_t>(outEnd - out) / 4);
+                    graphics::Color color;
+                    std::memcpy(&color, &px, 4);
+                    std::fill_n(reinterpret_cast<graphics::Color*>(out), run, color);
+                    out += run * 4;
+                    index[hashIndex(px)] = px; // The initial pixel may not be indexed yet
+                    continue;
+                }
+            }
+            index[hashIndex(px)] = px;
+            std::memcpy(out, &px, 4);
+            out += 4;
+        }
+        return image;
+    }
+
+}
+}
+}
@@ -0,0 +1,208 @@
+#include "astro/core/io/TGAImage.hpp"
+#include "astro/core/io/MappedFile.hpp"
+#include "PixelRows.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace astro {
+namespace core {
+namespace io {
+
+namespace {
+    // Converts 'count' BGR(A) pixels to RGBA
+    using SwizzleFn = detail::ExpandRowFn;
+
+    // --- Scalar kernels -------------------------------
+    void swizzleBGRAScalar(const uint8_t* src, graphics::Color* dst, size_t count) {
+        uint8_t* d = reinterpret_cast<uint8_t*>(dst);
+        for (size_t x = 0; x < count; ++x, src += 4, d += 4) {
+            d[0] = src[2]; d[1] = src[1]; d[2] = src[0]; d[3] = src[3];
+        }
+    }
+
+#ifdef ASTRO_IO_SIMD_X86
+    // --- SSSE3 kernels --------------------------------
+    __attribute__((target("ssse3")))
+    void swizzleBGRASSSE3(const uint8_t* src, graphics::Color* dst, size_t count) {
+        const __m128i mask = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+        const __m128i* s = reinterpret_cast<const __m128i*>(src);
+        __m128i* d = reinterpret_cast<__m128i*>(dst);
+
+        // 16 pixels per iteration
+        size_t x = 0;
+        for (; x + 16 <= count; x += 16, s += 4, d += 4) {
+            const __m128i v0 = _mm_loadu_si128(s + 0);
+            const __m128i v1 = _mm_loadu_si128(s + 1);
+            const __m128i v2 = _mm_loadu_si128(s + 2);
+            const __m128i v3 = _mm_loadu_si128(s + 3);
+            _mm_storeu_si128(d + 0, _mm_shuffle_epi8(v0, mask));
+            _mm_storeu_si128(d + 1, _mm_shuffle_epi8(v1, mask));
+            _mm_storeu_si128(d + 2, _mm_shuffle_epi8(v2, mask));
+            _mm_storeu_si128(d + 3, _mm_shuffle_epi8(v3, mask));
+        }
+        for (; x + 4 <= count; x += 4, ++s, ++d) {
+            _mm_storeu_si128(d, _mm_shuffle_epi8(_mm_loadu_si128(s), mask));
+        }
+        swizzleBGRAScalar(src + x * 4, dst + x, count - x);
+    }
+#endif
+
+    SwizzleFn selectSwizzle(int bytesPerPixel) {
+#ifdef ASTRO_IO_SIMD_X86
+        if (bytesPerPixel == 4 && __builtin_cpu_supports("ssse3")) return swizzleBGRASSSE3;
+#endif
+        return (bytesPerPixel == 4) ? swizzleBGRAScalar : detail::selectExpandRow24<2, 1, 0>();
+    }
+
+    /**
+     * @brief Writes decoded pixels in file order into the texture rows (bottom-up files are
+     * flipped by walking the rows backwards). Runs may cross row ends.
+     */
+    class RowWriter {
+    public:
+        RowWriter(graphics::Texture& image, bool topDown)
+            : image(image), row(topDown ? 0 : image.height - 1), step(topDown ? 1 : -1) {}
+
+        size_t remaining() const { return remainingPixels; }
+
+        // Copies 'count' source pixels
+        void copy(SwizzleFn swizzle, const uint8_t* src, size_t count, int bytesPerPixel) {
+            while (count > 0) {
+                const size_t n = std::min(count, rowLeft());
+                if (n >= 8) swizzle(src, cursor(), n);
+                else if (bytesPerPixel == 4) swizzleBGRAScalar(src, cursor(), n); // Short packets: no call
+                else detail::expandRow24Scalar<2, 1, 0>(src, cursor(), n);
+                src += n * bytesPerPixel;
+                advance(n);
+                count -= n;
+            }
+        }
+
+        // Repeats one color 'count' times
+        void fill(const graphics::Color& color, size_t count) {
+            while (count > 0) {
+                const size_t n = std::min(count, rowLeft());
+                std::fill_n(cursor(), n, color);
+                advance(n);
+                count -= n;
+            }
+        }
+
+    private:
+        graphics::Texture& image;
+        int row;
+        const int step;
+        size_t column = 0;
+        size_t remainingPixels = image.data.size();
+
+        size_t rowLeft() const { return static_cast<size_t>(image.width) - column; }
+        graphics::Color* cursor() { return image.data.data() + image.index(static_cast<int>(column), row); }
+        void advance(size_t n) {
+            column += n;
+            remainingPixels -= n;
+            if (column == static_cast<size_t>(image.width)) {
+                column = 0;
+                row += step;
+            }
+        }
+    };
+}
+
+    graphics::Texture TGAImage::readImage(const std::string& path) {
+        if (!std::filesystem::exists(path)) {
+            throw std::runtime_error("TGA Error: File not found: " + path);
+        }
+        const MappedFile file(path);
+        return readImageFromMemory(reinterpret_cast<const uint8_t*>(file.data()), file.size());
+    }
+
+    graphics::Texture TGAImage::readImageFromMemory(const uint8_t* data, size_t size) {
+        const uint8_t* const end = data + size;
+
+        // --- 1. Read Header ---
+        if (size < TGA_HEADER_SIZE) {
+            throw std::runtime_error("TGA Error: Could not read header.");
+        }
+        const uint8_t* header = data;
+
+        const uint8_t idLength     = header[0];
+        const uint8_t colorMapType = header[1];
+        const uint8_t imageType    = header[2];
+
+        // Validate Image Type (Support 2 and 10)
+        if (imageType != TGA_TYPE_UNCOMPRESSED_RGB && imageType != TGA_TYPE_RLE_RGB) {
+            throw std::runtime_error("TGA Error: Unsupported image type (" + std::to_string(imageType) +
+                                     "). Only Type 2 (RGB) and Type 10 (RLE RGB) are supported.");
+        }
+
+        const int width  = header[12] | (header[13] << 8);
+        const int height = header[14] | (header[15] << 8);
+        const int bpp    = header[16];
+        const int descriptor = header[17];
+
+        if (width <= 0 || height <= 0) {
+            throw std::runtime_error("TGA Error: Invalid dimensions.");
+        }
+        if (bpp != 24 && bpp != 32) {
+            throw std::runtime_error("TGA Error: Unsupported bit depth: " + std::to_string(bpp));
+        }
+
+        // --- 2. Skip Metadata ---
+        const int colorMapLen = header[5] | (header[6] << 8);
+        const int colorMapEntrySize = header[7];
+        const size_t skipSize = idLength + (colorMapType == 1 ? (colorMapLen * (colorMapEntrySize / 8)) : 0);
+        if (skipSize > size - TGA_HEADER_SIZE) {
+            throw std::runtime_error("TGA Error: Could not read header.");
+        }
+        const uint8_t* p = data + TGA_HEADER_SIZE + skipSize;
+
+        // --- 3. Decode straight into the texture ---
+        const int bytesPerPixel = bpp / 8;
+        const SwizzleFn swizzle = selectSwizzle(bytesPerPixel);
+        graphics::Texture image(width, height);
+        RowWriter out(image, (descriptor & 0x20) != 0);
+
+        if (imageType == TGA_TYPE_UNCOMPRESSED_RGB) {
+            // TYPE 2: the whole pixel array at once
+            if (static_cast<size_t>(end - p) / bytesPerPixel < out.remaining()) {
+                throw std::runtime_error("TGA Error: Failed to read uncompressed data.");
+            }
+            out.copy(swizzle, p, out.remaining(), bytesPerPixel);
+        }
+        else {
+            // TYPE 10: RLE Decode
+            // 1. Read packet header (1 byte).
+            // 2. If bit 7 is 0: It's a RAW packet, (header + 1) pixels follow.
+            // 3. If bit 7 is 1: It's an RLE packet, 1 pixel repeated (header - 127) times.
+            // A truncated stream leaves the rest of the image black
+            while (out.remaining() > 0 && p < end) {
+                const uint8_t chunkHeader = *p++;
+
+                if (chunkHeader < 128) {
+                    // RAW Packet
+                    const size_t count = std::min<size_t>(chunkHeader + 1, out.remaining());
+                    if (static_cast<size_t>(end - p) / bytesPerPixel < count) {
+                        throw std::runtime_error("TGA Error: Unexpected EOF in RLE Raw packet.");
+                    }
+                    out.copy(swizzle, p, count, bytesPerPixel);
+                    p += count * bytesPerPixel; // Pixels past the image are ignored
+                } else {
+                    // RLE Packet
+                    const size_t count = std::min<size_t>(chunkHeader - 127, out.remaining());
+                    if (end - p < bytesPerPixel) {
+                        throw std::runtime_error("TGA Error: Unexpected EOF in RLE Repeat packet.");
+                    }
+                    const graphics::Color color(p[2], p[1], p[0], (bytesPerPixel == 4) ? p[3] : 255);
+                    out.fill(color, count);
+                    p += bytesPerPixel;
+                }
+            }
+        }
+
+        return image;
+    }
+
+}
+}
+}
@@ -0,0 +1,175 @@
+#include "astro/core/io/TextureFile.hpp"
+#include "astro/core/io/TGAImage.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+
+namespace astro {
+namespace core {
+namespace io {
+
+static_assert(std::is_trivially_copyable_v<graphics::Color>, "Colors are stored as raw bytes");
+static_assert(sizeof(TextureFile::Header) == 184, "The header layout is part of the file format (bump VERSION)");
+
+namespace {
+    constexpr size_t alignUp(size_t value) { return (value + TextureFile::ALIGNMENT - 1) & ~(TextureFile::ALIGNMENT - 1); }
+
+    std::pair<int, int> mipSize(int width, int height, int level) {
+        return {std::max(1, width >> level), std::max(1, height >> level)};
+    }
+
+    int mipCount(int width, int height) {
+        int levels = 1;
+        while ((width >> levels) > 0 || (height >> levels) > 0) ++levels;
+        return levels;
+    }
+}
+
+    TextureFile::TextureFile(const std::string& filepath) {
+        file = std::make_shared<MappedFile>(filepath, false, true);
+        const char* data = file->data();
+        const size_t size = file->size();
+
+        Header header;
+        if (size < sizeof(Header)) throw std::runtime_error("TextureFile Error: Truncated file: " + filepath);
+        std::memcpy(&header, data, sizeof(Header));
+        if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0)
+            throw std::runtime_error("TextureFile Error: Not an astrotex file: " + filepath);
+        if (header.version != VERSION || header.pixelSize != sizeof(graphics::Color))
+            throw std::runtime_error("TextureFile Error: Incompatible version or pixel layout: " + filepath);
+        if (header.width <= 0 || header.height <= 0 || header.levels == 0 ||
+            header.levels > static_cast<uint32_t>(std::min(MAX_LEVELS, mipCount(header.width, header.height))))
+            throw std::runtime_error("TextureFile Error: Invalid dimensions: " + filepath);
+
+        for (uint32_t i = 0; i < header.levels; ++i) {
+            const auto [w, h] = mipSize(header.width, header.height, static_cast<int>(i));
+            const uint64_t offset = header.levelOffset[i];
+            const uint64_t bytes = static_cast<uint64_t>(w) * h * sizeof(graphics::Color);
+            if (offset % ALIGNMENT != 0 || offset > size || bytes > size - offset)
+                throw std::runtime_error("TextureFile Error: Truncated file: " + filepath);
+            levelSizes.push_back({w, h});
+            levelOffsets.push_back(static_cast<size_t>(offset));
+        }
+        stamp = header.source;
+    }
+
+    TextureFile::TextureFile(std::vector<graphics::Texture> levels) {
+        for (graphics::Texture& level : levels) {
+            levelSizes.push_back({level.width, level.height});
+            levelOffsets.push_back(0);
+            ownedLevels.push_back(std::make_shared<graphics::Texture>(std::move(level)));
+        }
+    }
+
+    graphics::Texture TextureFile::level(int i) const {
+        const auto [w, h] = levelSizes.at(i);
+        if (!file) {
+            const std::shared_ptr<graphics::Texture>& owned = ownedLevels[i];
+            return graphics::Texture(w, h, owned->data.data(), owned);
+        }
+        graphics::Color* pixels = reinterpret_cast<graphics::Color*>(file->mutableData() + levelOffsets[i]);
+        return graphics::Texture(w, h, pixels, file);
+    }
+
+    graphics::Texture TextureFile::downsample(const graphics::Texture& image) {
+        const auto [w, h] = mipSize(image.width, image.height, 1);
+        graphics::Texture mip(w, h);
+        for (int y = 0; y < h; ++y) {
+            const graphics::Color* row0 = image.data.data() + image.index(0, std::min(2 * y, image.height - 1));
+            const graphics::Color* row1 = image.data.data() + image.index(0, std::min(2 * y + 1, image.height - 1));
+            graphics::Color* out = mip.data.data() + mip.index(0, y);
+            for (int x = 0; x < w; ++x) {
+                const int x0 = std::min(2 * x, image.width - 1), x1 = std::min(2 * x + 1, image.width - 1);
+                for (int c = 0; c < 4; ++c) {
+                    const int sum = row0[x0][c] + row0[x1][c] + row1[x0][c] + row1[x1][c];
+                    out[x][c] = static_cast<uint8_t>((sum + 2) / 4);
+                }
+            }
+        }
+        return mip;
+    }
+
+    void TextureFile::write(const std::string& filepath, const graphics::Texture& image, bool mips, const FileStamp& source) {
+        const int levels = mips ? mipCount(image.width, image.height) : 1;
+        if (levels > MAX_LEVELS) throw std::runtime_error("TextureFile Error: Texture too large: " + filepath);
+
+        Header header{};
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+        header.pixelSize = sizeof(graphics::Color);
+        header.width = image.width;
+        header.height = image.height;
+        header.levels = static_cast<uint32_t>(levels);
+        header.source = source;
+        size_t offset = alignUp(sizeof(Header));
+        for (int i = 0; i < levels; ++i) {
+            const auto [w, h] = mipSize(image.width, image.height, i);
+            header.levelOffset[i] = offset;
+            offset = alignUp(offset + static_cast<size_t>(w) * h * sizeof(graphics::Color));
+        }
+
+        writeFileAtomically(filepath, [&](std::ostream& fs) {
+            const char padding[ALIGNMENT] = {};
+            fs.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+            size_t written = sizeof(Header);
+            graphics::Texture mip(0, 0);
+            const graphics::Texture* current = &image;
+            for (int i = 0; i < levels; ++i) {
+                if (i > 0) {
+                    mip = downsample(*current);
+                    current = &mip;
+                }
+                fs.write(padding, static_cast<std::streamsize>(header.levelOffset[i] - written));
+                const size_t bytes = current->data.size() * sizeof(graphics::Color);
+                fs.write(reinterpret_cast<const char*>(current->data.data()), static_cast<std::streamsize>(bytes));
+                written = header.levelOffset[i] + bytes;
+            }
+        });
+    }
+
+    std::string TextureFile::cachePath(const std::string& imagePath) {
+        return std::filesystem::path(imagePath).replace_extension(".astrotex").string();
+    }
+
+    TextureFile TextureFile::loadTGA(const std::string& tgaPath, bool mips) {
+        if (!std::filesystem::exists(tgaPath)) {
+            throw std::runtime_error("TGA Error: File not found: " + tgaPath);
+        }
+        FileStamp source = FileStamp::quick(tgaPath);
+        const std::string cache = cachePath(tgaPath);
+
+        // 1. Valid cache (see FileStamp::validateCache), with mips if they are wanted
+        if (std::filesystem::exists(cache)) {
+            try {
+                TextureFile texture(cache);
+                const bool complete = !mips || texture.levels() > 1 || (texture.width() == 1 && texture.height() == 1);
+                if (complete && FileStamp::validateCache(tgaPath, source, cache, offsetof(Header, source), texture.stamp)) return texture;
+            } catch (std::runtime_error& e) {
+                std::cerr << "TextureFile Warning: Rebuilding invalid cache (" << e.what() << ")." << std::endl;
+            }
+        }
+
+        // 2. Decode the TGA and rebuild the cache
+        graphics::Texture image = TGAImage::readImage(tgaPath);
+        if (source.hash == 0) source = FileStamp::of(tgaPath);
+        try {
+            write(cache, image, mips, source);
+            return TextureFile(cache);
+        } catch (std::runtime_error& e) {
+            std::cerr << "TextureFile Warning: " << e.what() << ", using the decoded texture." << std::endl;
+            std::vector<graphics::Texture> levels;
+            levels.push_back(std::move(image));
+            for (int i = 1; mips && i < mipCount(levels[0].width, levels[0].height); ++i)
+                levels.push_back(downsample(levels.back()));
+            return TextureFile(std::move(levels));
+        }
+    }
+
+}
+}
+}
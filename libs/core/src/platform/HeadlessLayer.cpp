@@ -0,0 +1,115 @@
+#include "astro/core/platform/HeadlessLayer.hpp"
+#include "astro/core/platform/LayerConfig.hpp"
+#include "astro/core/io/PPMImage.hpp"
+#include "astro/graphics/graphics.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace astro {
+namespace core {
+namespace platform {
+
+    void HeadlessLayer::initialize(const LayerConfig& layerConfig) {
+        if (layerConfig.displayWidth <= 0 || layerConfig.displayHeight <= 0) {
+            throw std::runtime_error("[HeadlessLayer] ERROR: Invalid display size");
+        }
+        if (!options.dumpDirectory.empty() && !std::filesystem::is_directory(options.dumpDirectory)) {
+            throw std::runtime_error("[HeadlessLayer] ERROR: Frame dump directory does not exist: '" + options.dumpDirectory + "'");
+        }
+
+        frontBuffer = graphics::Texture(layerConfig.displayWidth, layerConfig.displayHeight);
+        frameTimestamps.clear();
+        frameCount = 0;
+
+        if (!options.capturePath.empty()) {
+            capture.open(options.capturePath, layerConfig.displayWidth, layerConfig.displayHeight, options.capture);
+        }
+
+        swapChain.initialize(layerConfig.displayWidth, layerConfig.displayHeight, layerConfig.swapChainLength, layerConfig.asyncPresent,
+            [this](const graphics::Texture& canvas) { presentCanvas(canvas); });
+    }
+
+    void HeadlessLayer::processEvents(LayerEvent& layerEvent) {
+        // There is no window: nothing can generate events
+        layerEvent.type = LayerEventType::EvtNone;
+    }
+
+    graphics::Texture& HeadlessLayer::acquireCanvas() {
+        return swapChain.acquire();
+    }
+
+    void HeadlessLayer::present(graphics::Texture& canvas) {
+        swapChain.present(canvas);
+    }
+
+    void HeadlessLayer::render(const graphics::Texture& canvas) {
+        // Compatibility path: without a presenter thread there is no need to copy into the swap chain
+        if (!swapChain.isAsync()) {
+            presentCanvas(canvas, true);
+            return;
+        }
+        IPlatformLayer::render(canvas);
+    }
+
+    void HeadlessLayer::close() {
+        swapChain.shutdown();
+        capture.close();
+    }
+
+    const graphics::Texture& HeadlessLayer::getFrontBuffer() {
+        swapChain.flush();
+        return frontBuffer;
+    }
+
+    size_t HeadlessLayer::getFrameCount() {
+        swapChain.flush();
+        return frameCount;
+    }
+
+    const std::vector<HeadlessLayer::Clock::time_point>& HeadlessLayer::getFrameTimestamps() {
+        swapChain.flush();
+        return frameTimestamps;
+    }
+
+    void HeadlessLayer::presentCanvas(const graphics::Texture& canvas, bool fullFrame) {
+        // Copy the damaged regions into the front buffer (the "screen")
+        const int max_x = std::min(frontBuffer.width, canvas.width);
+        const int max_y = std::min(frontBuffer.height, canvas.height);
+        const graphics::Rect full_rect = {0, 0, max_x, max_y};
+        const std::vector<graphics::Rect> full_damage = {full_rect};
+        const std::vector<graphics::Rect>& damage = fullFrame ? full_damage : canvas.damage;
+
+        for (const graphics::Rect& rect : damage) {
+            const int x0 = std::max(rect.x, 0);
+            const int y0 = std::max(rect.y, 0);
+            const int x1 = std::min(rect.x + rect.width, max_x);
+            const int y1 = std::min(rect.y + rect.height, max_y);
+            for (int y = y0; y < y1; ++y) {
+                const auto src_row = canvas.data.begin() + canvas.index(x0, y);
+                std::copy(src_row, src_row + (x1 - x0), frontBuffer.data.begin() + frontBuffer.index(x0, y));
+            }
+        }
+
+        if (options.recordFrameTimes) frameTimestamps.push_back(Clock::now());
+
+        // Dump the frame
+        if (!options.dumpDirectory.empty() && frameCount % std::max(options.dumpEvery, 1) == 0) {
+            char filename[32];
+            std::snprintf(filename, sizeof(filename), "frame_%06zu.ppm", frameCount);
+            io::PPMImage::writeImage((std::filesystem::path(options.dumpDirectory) / filename).string(), frontBuffer);
+        }
+
+        // Stream the frame: only a copy here, conversion and disk writes happen on the capture
+        // thread (whose errors are rethrown here)
+        if (!options.capturePath.empty()) capture.submit(frontBuffer);
+        frameCount++;
+    }
+
+}
+}
+}
@@ -0,0 +1,179 @@
+#include "astro/core/platform/SwapChain.hpp"
+#include "astro/graphics/graphics.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+namespace astro {
+namespace core {
+namespace platform {
+
+namespace {
+    void copyRegion(const graphics::Texture& src, graphics::Texture& dst, const graphics::Rect& r) {
+        for (int y = r.y; y < r.y + r.height; ++y) {
+            const auto first = src.data.begin() + src.index(r.x, y);
+            std::copy(first, first + r.width, dst.data.begin() + dst.index(r.x, y));
+        }
+    }
+}
+
+    void SwapChain::initialize(int width, int height, int length, bool async, PresentFn presentFn) {
+        shutdown();
+
+        this->async = async;
+        this->presentFn = std::move(presentFn);
+        length = async ? std::clamp(length, 2, MAX_LENGTH) : 1;
+
+        canvases.clear();
+        freeCanvases.clear();
+        readyCanvases.clear();
+        presenting = nullptr;
+        presenterError = nullptr;
+        canvasFrames.assign(length, -1);
+        damageHistory.clear();
+        submittedFrames = 0;
+        lastSubmitted = nullptr;
+        for (int i = 0; i < length; ++i) {
+            canvases.push_back(std::make_unique<graphics::Texture>(width, height));
+            freeCanvases.push_back(canvases.back().get());
+        }
+
+        if (async) {
+            running = true;
+            presenter = std::thread(&SwapChain::presenterLoop, this);
+        }
+    }
+
+    graphics::Texture& SwapChain::acquire() {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (canvases.empty()) {
+            throw std::runtime_error("[SwapChain] ERROR: acquire() called before initialize()");
+        }
+        cv.wait(lock, [this] { return !freeCanvases.empty() || presenterError; });
+        rethrowPresenterError();
+
+        graphics::Texture* canvas = freeCanvases.front();
+        freeCanvases.pop_front();
+
+        // Collect what changed since this canvas was last submitted
+        const graphics::Texture* source = lastSubmitted;
+        std::vector<graphics::Rect> stale;
+        bool fullCopy = false;
+        if (source != nullptr && source != canvas) {
+            const long lastFrame = canvasFrames[canvasSlot(canvas)];
+            const long age = submittedFrames - lastFrame;
+            fullCopy = lastFrame < 0 || age > static_cast<long>(damageHistory.size());
+            if (!fullCopy) {
+                for (auto it = damageHistory.end() - age; it != damageHistory.end(); ++it) {
+                    stale.insert(stale.end(), it->begin(), it->end());
+                }
+            }
+        }
+        lock.unlock();
+
+        // The source canvas is only read by the presenter, so it can be copied without the lock
+        if (fullCopy) {
+            canvas->data = source->data;
+        } else {
+            for (const graphics::Rect& r : stale) copyRegion(*source, *canvas, r);
+        }
+        graphics::clearDamage(*canvas);
+        return *canvas;
+    }
+
+    void SwapChain::present(graphics::Texture& canvas) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            rethrowPresenterError();
+
+            // Only canvases handed out by acquire() can be presented
+            const bool owned = canvasSlot(&canvas) >= 0;
+            const bool isFree = std::find(freeCanvases.begin(), freeCanvases.end(), &canvas) != freeCanvases.end();
+            const bool isQueued = std::find(readyCanvases.begin(), readyCanvases.end(), &canvas) != readyCanvases.end();
+            if (!owned || isFree || isQueued || presenting == &canvas) {
+                throw std::runtime_error("[SwapChain] ERROR: present() requires a canvas obtained from acquire()");
+            }
+
+            canvasFrames[canvasSlot(&canvas)] = ++submittedFrames;
+            damageHistory.push_back(canvas.damage);
+            if (static_cast<int>(damageHistory.size()) > MAX_LENGTH) damageHistory.pop_front();
+            lastSubmitted = &canvas;
+
+            if (async) {
+                readyCanvases.push_back(&canvas);
+                cv.notify_all();
+                return;
+            }
+        }
+
+        // Sync mode: present in place and release the canvas
+        presentFn(canvas);
+        std::lock_guard<std::mutex> lock(mutex);
+        freeCanvases.push_back(&canvas);
+    }
+
+    void SwapChain::flush() {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this] {
+            return (readyCanvases.empty() && presenting == nullptr) || presenterError || !running;
+        });
+        rethrowPresenterError();
+    }
+
+    void SwapChain::shutdown() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            running = false;
+            cv.notify_all();
+        }
+        if (presenter.joinable()) presenter.join();
+    }
+
+    int SwapChain::canvasSlot(const graphics::Texture* canvas) const {
+        for (size_t i = 0; i < canvases.size(); ++i) {
+            if (canvases[i].get() == canvas) return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+    void SwapChain::presenterLoop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            cv.wait(lock, [this] { return !readyCanvases.empty() || !running; });
+            if (readyCanvases.empty()) break; // Stopped and nothing left to present
+
+            presenting = readyCanvases.front();
+            readyCanvases.pop_front();
+
+            // Present without holding the lock so the renderer can keep queueing frames
+            lock.unlock();
+            std::exception_ptr error = nullptr;
+            try {
+                presentFn(*presenting);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            lock.lock();
+
+            freeCanvases.push_back(presenting);
+            presenting = nullptr;
+            if (error) {
+                // Errors are sticky: the chain stops presenting and reports them to the renderer
+                presenterError = error;
+                freeCanvases.insert(freeCanvases.end(), readyCanvases.begin(), readyCanvases.end());
+                readyCanvases.clear();
+                running = false;
+            }
+            cv.notify_all();
+        }
+    }
+
+    void SwapChain::rethrowPresenterError() {
+        if (presenterError) std::rethrow_exception(presenterError);
+    }
+
+}
+}
+}
@@ -3,6 +3,7 @@
 #include "astro/core/platform/LayerConfig.hpp"
 #include "astro/graphics/graphics.hpp"
 
+#include <algorithm>
 #include <clocale>
 #include <cstdint>
 #include <cstring>
@@ -19,12 +20,131 @@
 #include <X11/keysym.h>
 #include <vector>
 
+// x86 SIMD kernels are compiled per-function and selected at runtime
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define ASTRO_X11_SIMD_X86
+    #include <immintrin.h>
+#endif
+
 namespace astro {
 namespace core {
 namespace platform {
 
+namespace {
+    static_assert(sizeof(graphics::Color) == 4, "Pixel kernels expect tightly packed RGBA colors");
+
+    // --- Scalar kernels -------------------------------
+    // Destination byte k of each pixel is taken from source (RGBA) byte Pk
+    template <int P0, int P1, int P2, int P3>
+    void convertRow32Scalar(const graphics::Color* src, uint8_t* dst, int count) {
+        const uint8_t* s = reinterpret_cast<const uint8_t*>(src);
+        for (int x = 0; x < count; ++x, s += 4, dst += 4) {
+            dst[0] = s[P0]; dst[1] = s[P1]; dst[2] = s[P2]; dst[3] = s[P3];
+        }
+    }
+    template <int P0, int P1, int P2>
+    void convertRow24Scalar(const graphics::Color* src, uint8_t* dst, int count) {
+        const uint8_t* s = reinterpret_cast<const uint8_t*>(src);
+        for (int x = 0; x < count; ++x, s += 4, dst += 3) {
+            dst[0] = s[P0]; dst[1] = s[P1]; dst[2] = s[P2];
+        }
+    }
+
+#ifdef ASTRO_X11_SIMD_X86
+    // --- SSSE3 kernels --------------------------------
+    template <int P0, int P1, int P2, int P3>
+    __attribute__((target("ssse3")))
+    void convertRow32SSSE3(const graphics::Color* src, uint8_t* dst, int count) {
+        const __m128i mask = _mm_setr_epi8(
+            P0, P1, P2, P3,  P0 + 4, P1 + 4, P2 + 4, P3 + 4,
+            P0 + 8, P1 + 8, P2 + 8, P3 + 8,  P0 + 12, P1 + 12, P2 + 12, P3 + 12);
+        const __m128i* s = reinterpret_cast<const __m128i*>(src);
+        __m128i* d = reinterpret_cast<__m128i*>(dst);
+
+        // 16 pixels per iteration
+        int x = 0;
+        for (; x + 16 <= count; x += 16, s += 4, d += 4) {
+            const __m128i v0 = _mm_loadu_si128(s + 0);
+            const __m128i v1 = _mm_loadu_si128(s + 1);
+            const __m128i v2 = _mm_loadu_si128(s + 2);
+            const __m128i v3 = _mm_loadu_si128(s + 3);
+            _mm_storeu_si128(d + 0, _mm_shuffle_epi8(v0, mask));
+            _mm_storeu_si128(d + 1, _mm_shuffle_epi8(v1, mask));
+            _mm_storeu_si128(d + 2, _mm_shuffle_epi8(v2, mask));
+            _mm_storeu_si128(d + 3, _mm_shuffle_epi8(v3, mask));
+        }
+        for (; x + 4 <= count; x += 4, ++s, ++d) {
+            _mm_storeu_si128(d, _mm_shuffle_epi8(_mm_loadu_si128(s), mask));
+        }
+        convertRow32Scalar<P0, P1, P2, P3>(src + x, dst + x * 4, count - x);
+    }
+
+    template <int P0, int P1, int P2>
+    __attribute__((target("ssse3")))
+    void convertRow24SSSE3(const graphics::Color* src, uint8_t* dst, int count) {
+        // Packs 4 pixels into the low 12 bytes, upper 4 bytes are zeroed
+        const __m128i mask = _mm_setr_epi8(
+            P0, P1, P2,  P0 + 4, P1 + 4, P2 + 4,  P0 + 8, P1 + 8, P2 + 8,  P0 + 12, P1 + 12, P2 + 12,
+            -1, -1, -1, -1);
+        const __m128i* s = reinterpret_cast<const __m128i*>(src);
+        __m128i* d = reinterpret_cast<__m128i*>(dst);
+
+        // 16 pixels (48 bytes) per iteration, stitched into 3 full stores
+        int x = 0;
+        for (; x + 16 <= count; x += 16, s += 4, d += 3) {
+            const __m128i a = _mm_shuffle_epi8(_mm_loadu_si128(s + 0), mask);
+            const __m128i b = _mm_shuffle_epi8(_mm_loadu_si128(s + 1), mask);
+            const __m128i c = _mm_shuffle_epi8(_mm_loadu_si128(s + 2), mask);
+            const __m128i e = _mm_shuffle_epi8(_mm_loadu_si128(s + 3), mask);
+            _mm_storeu_si128(d + 0, _mm_or_si128(a, _mm_slli_si128(b, 12)));
+            _mm_storeu_si128(d + 1, _mm_or_si128(_mm_srli_si128(b, 4), _mm_slli_si128(c, 8)));
+            _mm_storeu_si128(d + 2, _mm_or_si128(_mm_srli_si128(c, 8), _mm_slli_si128(e, 4)));
+        }
+        convertRow24Scalar<P0, P1, P2>(src + x, dst + x * 3, count - x);
+    }
+
+    // --- AVX2 kernels ---------------------------------
+    template <int P0, int P1, int P2, int P3>
+    __attribute__((target("avx2")))
+    void convertRow32AVX2(const graphics::Color* src, uint8_t* dst, int count) {
+        // vpshufb works per 128-bit lane, so the same mask is repeated on both lanes
+        const __m256i mask = _mm256_setr_epi8(
+            P0, P1, P2, P3,  P0 + 4, P1 + 4, P2 + 4, P3 + 4,
+            P0 + 8, P1 + 8, P2 + 8, P3 + 8,  P0 + 12, P1 + 12, P2 + 12, P3 + 12,
+            P0, P1, P2, P3,  P0 + 4, P1 + 4, P2 + 4, P3 + 4,
+            P0 + 8, P1 + 8, P2 + 8, P3 + 8,  P0 + 12, P1 + 12, P2 + 12, P3 + 12);
+        const __m256i* s = reinterpret_cast<const __m256i*>(src);
+        __m256i* d = reinterpret_cast<__m256i*>(dst);
+
+        // 32 pixels per iteration
+        int x = 0;
+        for (; x + 32 <= count; x += 32, s += 4, d += 4) {
+            const __m256i v0 = _mm256_loadu_si256(s + 0);
+            const __m256i v1 = _mm256_loadu_si256(s + 1);
+            const __m256i v2 = _mm256_loadu_si256(s + 2);
+            const __m256i v3 = _mm256_loadu_si256(s + 3);
+            _mm256_storeu_si256(d + 0, _mm256_shuffle_epi8(v0, mask));
+            _mm256_storeu_si256(d + 1, _mm256_shuffle_epi8(v1, mask));
+            _mm256_storeu_si256(d + 2, _mm256_shuffle_epi8(v2, mask));
+            _mm256_storeu_si256(d + 3, _mm256_shuffle_epi8(v3, mask));
+        }
+        for (; x + 8 <= count; x += 8, ++s, ++d) {
+            _mm256_storeu_si256(d, _mm256_shuffle_epi8(_mm256_loadu_si256(s), mask));
+        }
+        convertRow32SSSE3<P0, P1, P2, P3>(src + x, dst + x * 4, count - x);
+    }
+#endif
+}
+
     void X11Layer::initialize(const LayerConfig& layerConfig){
+        // The presenter thread issues Xlib calls concurrently with processEvents()
+        if (layerConfig.asyncPresent && XInitThreads() == 0) {
+            throw std::runtime_error("[X11Layer] ERROR: Could not initialize Xlib thread support");
+        }
         display = XOpenDisplay(NULL); // Create connection with XServer
+        if (display == NULL) {
+            throw std::runtime_error("[X11Layer] ERROR: Could not open X display (use the headless layer without a display)");
+        }
         window = XCreateSimpleWindow(
             display,
             XDefaultRootWindow(display),	// parent
@@ -41,7 +161,8 @@ namespace platform {
         windowHeight = windowAttr.height;
         
         // Listen for requested events
-        long event_mask = layerEventToX11(layerConfig.requestedEvents);
+        // (Expose is always needed to repaint the window after the X server drops its contents)
+        long event_mask = layerEventToX11(layerConfig.requestedEvents) | ExposureMask;
         XSelectInput(display, window, event_mask);
         XMapWindow(display, window); // Show the window
         
@@ -110,13 +231,56 @@ namespace platform {
         const int x_bpp = ximage->bits_per_pixel / 8;   // Bytes per pixel for XImage (e.g., 4)
         const int x_bpr = ximage->bytes_per_line;       // Total bytes per line for XImage (includes padding)
 
-        // Pre-calculate format checks to avoid branching in the inner loop
-        const bool is_32bit = (x_bpp == 4);
-        const bool is_lsb = (is_32bit && ximage->byte_order == LSBFirst);
-        const bool is_msb = (is_32bit && ximage->byte_order == MSBFirst);
-        const bool is_24bit_lsb = (x_bpp == 3 && ximage->byte_order == LSBFirst);
-        const bool is_24bit_msb = (x_bpp == 3 && ximage->byte_order == MSBFirst);
-        m_xrendering = RenderConfig(x_bpp, x_bpr, is_32bit, is_lsb, is_msb, is_24bit_lsb, is_24bit_msb);
+        // Select the conversion kernel once to avoid branching in the inner loop
+        ConvertRowFn convertRow = selectConvertRow(x_bpp, ximage->byte_order);
+        if (convertRow == nullptr) {
+            throw std::runtime_error("[X11Layer] ERROR: Unsupported XImage pixel format (" + 
+                std::to_string(ximage->bits_per_pixel) + " bits per pixel)");
+        }
+        m_xrendering = RenderConfig(x_bpp, x_bpr, convertRow);
+
+        // Swap chain: the presenter converts and sends frames while the renderer works on the next one
+        swapChain.initialize(windowWidth, windowHeight, layerConfig.swapChainLength, layerConfig.asyncPresent,
+            [this](const graphics::Texture& canvas) { presentCanvas(canvas); });
+    }
+
+    X11Layer::ConvertRowFn X11Layer::selectConvertRow(int x_bpp, int byte_order) {
+    #ifdef ASTRO_X11_SIMD_X86
+        const bool has_avx2 = __builtin_cpu_supports("avx2");
+        const bool has_ssse3 = __builtin_cpu_supports("ssse3");
+    #endif
+
+        if (x_bpp == 4 && byte_order == LSBFirst) {
+            // LSBFirst -> BGRA format
+        #ifdef ASTRO_X11_SIMD_X86
+            if (has_avx2) return convertRow32AVX2<2, 1, 0, 3>;
+            if (has_ssse3) return convertRow32SSSE3<2, 1, 0, 3>;
+        #endif
+            return convertRow32Scalar<2, 1, 0, 3>;
+        }
+        if (x_bpp == 4 && byte_order == MSBFirst) {
+            // MSBFirst -> ARGB format
+        #ifdef ASTRO_X11_SIMD_X86
+            if (has_avx2) return convertRow32AVX2<3, 0, 1, 2>;
+            if (has_ssse3) return convertRow32SSSE3<3, 0, 1, 2>;
+        #endif
+            return convertRow32Scalar<3, 0, 1, 2>;
+        }
+        if (x_bpp == 3 && byte_order == LSBFirst) {
+            // 24-bit BGR format
+        #ifdef ASTRO_X11_SIMD_X86
+            if (has_ssse3) return convertRow24SSSE3<2, 1, 0>;
+        #endif
+            return convertRow24Scalar<2, 1, 0>;
+        }
+        if (x_bpp == 3 && byte_order == MSBFirst) {
+            // 24-bit RGB format
+        #ifdef ASTRO_X11_SIMD_X86
+            if (has_ssse3) return convertRow24SSSE3<0, 1, 2>;
+        #endif
+            return convertRow24Scalar<0, 1, 2>;
+        }
+        return nullptr;
     }
 
     long X11Layer::layerEventToX11(LayerEventType requestedEvents) {
@@ -162,6 +326,11 @@ namespace platform {
                     }
                     break; 
                 }
+                case Expose: {
+                    // Window contents were lost: next present sends the whole frame
+                    fullPresentRequested = true;
+                    break;
+                }
                 case ConfigureNotify: {
                     // Sent when the window is resized or moved
                     layerEvent.type = LayerEventType::EvtWindowResize;
@@ -221,68 +390,70 @@ namespace platform {
         key_data.keycode = xkey_event->keycode;
     }
 
+    graphics::Texture& X11Layer::acquireCanvas() {
+        return swapChain.acquire();
+    }
+
+    void X11Layer::present(graphics::Texture& canvas) {
+        swapChain.present(canvas);
+    }
+
     void X11Layer::render(const graphics::Texture& canvas) {
+        // Compatibility path: without a presenter thread there is no need to copy into the swap chain
+        if (!swapChain.isAsync()) {
+            presentCanvas(canvas, true);
+            return;
+        }
+        IPlatformLayer::render(canvas);
+    }
+
+    void X11Layer::presentCanvas(const graphics::Texture& canvas, bool fullFrame) {
+        // Whole window on request or when the X server lost its contents, damaged regions otherwise
+        const bool fullRequested = fullPresentRequested.exchange(false);
+        const graphics::Rect window_rect = {0, 0, windowWidth, windowHeight};
+        const std::vector<graphics::Rect> full_damage = {window_rect};
+        const std::vector<graphics::Rect>& damage = (fullFrame || fullRequested) ? full_damage : canvas.damage;
+
         // Destination buffer
         unsigned char* dst_data = reinterpret_cast<unsigned char*>(ximage->data);
 
         // Get a pointer to the start of the canvas's pixel data
         const graphics::Color* src_data = canvas.data.data();
         const size_t canvas_width = static_cast<size_t>(canvas.width);
+        const int max_x = std::min(windowWidth, canvas.width);
+        const int max_y = std::min(windowHeight, canvas.height);
+
+        const ConvertRowFn convertRow = m_xrendering.convertRow;
+        for (const graphics::Rect& rect : damage) {
+            // Clip the region to both the window and the canvas
+            const int x0 = std::max(rect.x, 0);
+            const int y0 = std::max(rect.y, 0);
+            const int x1 = std::min(rect.x + rect.width, max_x);
+            const int y1 = std::min(rect.y + rect.height, max_y);
+            if (x0 >= x1 || y0 >= y1) continue;
+
+            // Row-by-row conversion (the kernel handles the pixel format)
+            for (int y = y0; y < y1; ++y) {
+                // Advance the source pointer by one full row (width * sizeof(Color))
+                const graphics::Color* src_row = src_data + y * canvas_width;
+                
+                // Advance the destination pointer by the XImage's bytes_per_line (which includes padding)
+                unsigned char* dst_row = dst_data + y * m_xrendering.x_bpr;
 
-        // Pixel-by-pixel conversion loop
-        for (int y = 0; y < windowHeight; ++y) {
-            // Advance the source pointer by one full row (width * sizeof(Color))
-            const graphics::Color* src_row = src_data + y * canvas_width;
-            
-            // Advance the destination pointer by the XImage's bytes_per_line (which includes padding)
-            unsigned char* dst_row = dst_data + y * m_xrendering.x_bpr;
-
-            // Cast destination row to uint32_t* (for writing a pixel at once)
-            uint32_t* dst_row_32 = reinterpret_cast<uint32_t*>(dst_row);
-
-            for (int x = 0; x < windowWidth; ++x) {
-                // Get the source pixel (RGBA) by simple array indexing
-                const graphics::Color& src_pixel = src_row[x]; 
-
-                // 2. Perform format conversion and write
-                if (m_xrendering.is_lsb) {
-                    // LSBFirst -> BGRA format
-                    dst_row_32[x] = (src_pixel[2]) |        // Blue
-                                  (src_pixel[1] << 8) |     // Green
-                                  (src_pixel[0] << 16) |    // Red
-                                  (src_pixel[3] << 24);     // Alpha (or 255 << 24)
-                } 
-                else if (m_xrendering.is_msb) {
-                    // MSBFirst -> ARGB format
-                    dst_row_32[x] = (src_pixel[3] << 24) |  // Alpha
-                                  (src_pixel[0] << 16) |    // Red
-                                  (src_pixel[1] << 8) |     // Green
-                                  (src_pixel[2]);           // Blue
-                }
-                else if (m_xrendering.is_24bit_lsb) {
-                    // 24-bit BGR format (fallback, slower)
-                    unsigned char* dst_pixel = dst_row + x * 3;
-                    dst_pixel[0] = src_pixel[2]; // Blue
-                    dst_pixel[1] = src_pixel[1]; // Green
-                    dst_pixel[2] = src_pixel[0]; // Red
-                }
-                else if (m_xrendering.is_24bit_msb) {
-                    // 24-bit RGB format (fallback, slower)
-                    unsigned char* dst_pixel = dst_row + x * 3;
-                    dst_pixel[0] = src_pixel[0]; // Red
-                    dst_pixel[1] = src_pixel[1]; // Green
-                    dst_pixel[2] = src_pixel[2]; // Blue
-                }
+                convertRow(src_row + x0, dst_row + x0 * m_xrendering.x_bpp, x1 - x0);
             }
+
+            // Actual rendering (only the damaged region is sent)
+            XPutImage(display, window, gc, ximage, x0, y0, x0, y0, x1 - x0, y1 - y0);
         }
-        
-        // Actual rendering
-        XPutImage(display, window, gc, ximage, 0, 0, 0, 0, windowWidth, windowHeight);
         XFlush(display);
     }
     
     void X11Layer::close(){
 
+        // Stop the presenter thread before releasing the X resources it uses
+        swapChain.shutdown();
+
         // Destroy input context
         if (inputContext != nullptr){
             XDestroyIC(inputContext);
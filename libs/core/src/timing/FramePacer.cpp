@@ -0,0 +1,97 @@
+#include "astro/core/timing/FramePacer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace astro {
+namespace core {
+namespace timing {
+
+namespace {
+    double toMs(FramePacer::Clock::duration d) {
+        return std::chrono::duration<double, std::milli>(d).count();
+    }
+}
+
+    FramePacer::FramePacer(double targetFps, double spinThresholdMs)
+        : spinThreshold(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(spinThresholdMs))) {
+        setTargetFps(targetFps);
+        reset();
+    }
+
+    void FramePacer::setTargetFps(double targetFps) {
+        this->targetFps = targetFps;
+        frameBudget = (targetFps > 0.0)
+            ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / targetFps))
+            : Clock::duration::zero();
+        deadline = frameStart + frameBudget;
+    }
+
+    void FramePacer::reset() {
+        frameStart = Clock::now();
+        deadline = frameStart + frameBudget;
+        currentSections.fill(Clock::duration::zero());
+    }
+
+    void FramePacer::addSectionTime(FrameSection section, Clock::duration duration) {
+        currentSections[static_cast<int>(section)] += duration;
+    }
+
+    void FramePacer::endFrame() {
+        if (frameBudget > Clock::duration::zero()) {
+            // Sleep for the bulk of the remaining budget, spin the tail for precision
+            const Clock::time_point sleepUntil = deadline - spinThreshold;
+            if (Clock::now() < sleepUntil) std::this_thread::sleep_until(sleepUntil);
+            while (Clock::now() < deadline) std::this_thread::yield();
+        }
+
+        // Record the frame
+        const Clock::time_point now = Clock::now();
+        const size_t slot = recordedFrames % HISTORY_LENGTH;
+        frameMs[slot] = toMs(now - frameStart);
+        for (int i = 0; i < SECTIONS; ++i) sectionMs[slot][i] = toMs(currentSections[i]);
+        recordedFrames++;
+
+        // Next frame. Deadlines advance by a fixed budget to avoid drift,
+        // unless the frame overran (then pacing restarts from now instead of rushing to catch up)
+        frameStart = now;
+        deadline += frameBudget;
+        if (deadline < now) deadline = now + frameBudget;
+        currentSections.fill(Clock::duration::zero());
+    }
+
+    FrameStats FramePacer::getStats() const {
+        FrameStats stats;
+        stats.frames = std::min(recordedFrames, static_cast<size_t>(HISTORY_LENGTH));
+        if (stats.frames == 0) return stats;
+
+        std::vector<double> frames(frameMs.begin(), frameMs.begin() + stats.frames);
+        double total = 0.0;
+        std::array<double, SECTIONS> sectionTotals{};
+        for (size_t i = 0; i < stats.frames; ++i) {
+            total += frames[i];
+            for (int s = 0; s < SECTIONS; ++s) sectionTotals[s] += sectionMs[i][s];
+        }
+
+        const double n = static_cast<double>(stats.frames);
+        stats.avgFrameMs = total / n;
+        stats.avgFps = (stats.avgFrameMs > 0.0) ? 1000.0 / stats.avgFrameMs : 0.0;
+        stats.avgUpdateMs = sectionTotals[static_cast<int>(FrameSection::Update)] / n;
+        stats.avgRenderMs = sectionTotals[static_cast<int>(FrameSection::Render)] / n;
+        stats.avgPresentMs = sectionTotals[static_cast<int>(FrameSection::Present)] / n;
+
+        // Nearest-rank 99th percentile
+        const auto [minIt, maxIt] = std::minmax_element(frames.begin(), frames.end());
+        stats.minFrameMs = *minIt;
+        stats.maxFrameMs = *maxIt;
+        const size_t p99Rank = static_cast<size_t>(0.99 * (stats.frames - 1) + 0.5);
+        std::nth_element(frames.begin(), frames.begin() + p99Rank, frames.end());
+        stats.p99FrameMs = frames[p99Rank];
+        return stats;
+    }
+
+}
+}
+}
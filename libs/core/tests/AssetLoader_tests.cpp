@@ -0,0 +1,81 @@
+#include "astro/core/io/AssetLoader.hpp"
+#include "astro/core/io/TGAImage.hpp"
+#include "astro_test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using namespace astro::core::io;
+using namespace astro::graphics;
+
+TEST(assetLoaderChain){
+    AssetLoader loader(2);
+    ASSERT_EQ(loader.threadCount(), 2);
+
+    // The chained job runs once its input is loaded, without blocking a worker
+    std::atomic<bool> release = false;
+    AssetHandle<int> base = loader.run([&release] {
+        while (!release) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        return 20;
+    });
+    AssetHandle<int> doubled = loader.then(base, [](const int& v) { return v * 2; });
+    AssetHandle<std::string> text = loader.then(doubled, [](const int& v) { return std::to_string(v + 2); });
+    ASSERT_FALSE(text.ready());
+    ASSERT_TRUE(text.tryGet() == nullptr);
+
+    release = true;
+    ASSERT_EQ(*text.get(), "42");
+    ASSERT_EQ(*doubled.get(), 40);
+
+    // Chaining on a loaded asset
+    ASSERT_EQ(*loader.then(base, [](const int& v) { return v + 1; }).get(), 21);
+    return true;
+}
+
+TEST(assetLoaderErrors){
+    AssetLoader loader(1);
+    AssetHandle<Texture> missing = loader.loadImage("/nonexistent/astro_missing.tga");
+    AssetHandle<int> width = loader.then(missing, [](const Texture& t) { return t.width; });
+    loader.wait();
+
+    ASSERT_TRUE(missing.failed());
+    ASSERT_TRUE(width.failed());
+    ASSERT_TRUE(width.tryGet() == nullptr);
+    try {
+        width.get();
+        ASSERT_TRUE(false);
+    } catch (std::runtime_error& e) {
+        ASSERT_TRUE(std::string(e.what()).find("TGA Error") != std::string::npos);
+    }
+    return true;
+}
+
+TEST(assetLoaderFiles){
+    const std::filesystem::path dir = std::filesystem::temp_directory_path();
+    Texture image(16, 8);
+    Color c(10, 20, 30);
+    clearTexture(image, c);
+    TGAImage::writeImage((dir / "astro_async.tga").string(), image);
+    std::ofstream((dir / "astro_async.obj").string(), std::ios_base::trunc)
+        << "v 0 0 0\nv 1 0 0\nv 0 1 0\nv 1 1 0\nvt 0 0\nvt 1 0\nvt 0 1\nvt 1 1\nvn 0 0 1\n"
+           "f 1/1/1 2/2/1 4/4/1 3/3/1\n";
+
+    AssetLoader loader;
+    std::filesystem::remove(TextureFile::cachePath((dir / "astro_async.tga").string()));
+    AssetHandle<Texture> texture = loader.loadImage((dir / "astro_async.tga").string());
+    AssetHandle<TextureFile> mips = loader.loadTexture((dir / "astro_async.tga").string());
+    AssetHandle<OBJFile> obj = loader.loadOBJ((dir / "astro_async.obj").string());
+    AssetHandle<MeshFile> mesh = loader.loadMesh((dir / "astro_async.obj").string());
+
+    ASSERT_TRUE(texture.get()->data == image.data);
+    ASSERT_EQ(mips.get()->levels(), 5);
+    ASSERT_EQ(obj.get()->indices.size(), 6);
+    ASSERT_TRUE(obj.get()->vertices[0].tangent == astro::math::Vec3f(1.0f, 0.0f, 0.0f));
+    ASSERT_EQ(mesh.get()->indices().size(), 6);
+    return true;
+}
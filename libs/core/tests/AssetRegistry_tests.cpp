@@ -0,0 +1,131 @@
+#include "astro/core/io/AssetLoader.hpp"
+#include "astro/core/io/AssetRegistry.hpp"
+#include "astro/core/io/TGAImage.hpp"
+#include "astro_test.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+using namespace astro::core::io;
+using namespace astro::graphics;
+
+static std::string tempTGA(const std::string& name, uint8_t shade) {
+    const std::string path = (std::filesystem::temp_directory_path() / name).string();
+    Texture image(8, 4);
+    Color c(shade, shade, shade);
+    clearTexture(image, c);
+    TGAImage::writeImage(path, image);
+    return path;
+}
+
+TEST(registryShares){
+    const std::string a = tempTGA("astro_registry_a.tga", 10);
+    const std::string copy = tempTGA("astro_registry_copy.tga", 10);
+    const std::string b = tempTGA("astro_registry_b.tga", 20);
+
+    AssetRegistry registry(true);
+    Material first, second, third;
+    first.colorTexture = registry.texture(a);
+    second.colorTexture = registry.texture(a);
+    third.colorTexture = registry.texture(copy);
+
+    // One instance for the same path and for the same content under another path
+    ASSERT_TRUE(first.colorTexture == second.colorTexture);
+    ASSERT_TRUE(first.colorTexture == third.colorTexture);
+    ASSERT_TRUE(registry.texture(b) != first.colorTexture);
+    ASSERT_EQ(registry.stats().loads, 2);
+    ASSERT_EQ(registry.stats().pathHits, 1);
+    ASSERT_EQ(registry.stats().contentHits, 1);
+
+    // Relative spellings of the path are the same asset
+    const std::string dotted = (std::filesystem::path(a).parent_path() / "." / "astro_registry_a.tga").string();
+    ASSERT_TRUE(registry.find<Texture>(dotted) == first.colorTexture);
+
+    // Types are registered separately
+    ASSERT_TRUE(registry.find<TextureFile>(a) == nullptr);
+
+    // Without shareContent only the path is looked up (no hash of the file)
+    AssetRegistry byPath;
+    const std::shared_ptr<Texture> own = byPath.texture(a);
+    ASSERT_TRUE(byPath.texture(a) == own);
+    ASSERT_TRUE(byPath.texture(copy) != own);
+    ASSERT_EQ(byPath.stats().loads, 2);
+    ASSERT_EQ(byPath.stats().contentHits, 0);
+    return true;
+}
+
+TEST(registryWeakReferences){
+    const std::string path = tempTGA("astro_registry_weak.tga", 30);
+    AssetRegistry registry;
+
+    std::shared_ptr<Texture> texture = registry.texture(path);
+    const std::weak_ptr<Texture> weak = texture;
+    ASSERT_EQ(registry.liveCount(), 1);
+
+    // The registry does not keep assets alive
+    texture.reset();
+    ASSERT_TRUE(weak.expired());
+    ASSERT_EQ(registry.liveCount(), 0);
+    ASSERT_TRUE(registry.find<Texture>(path) == nullptr);
+    registry.purge();
+
+    // Next request loads it again
+    texture = registry.texture(path);
+    ASSERT_TRUE(texture != nullptr);
+    ASSERT_EQ(registry.stats().loads, 2);
+    return true;
+}
+
+TEST(registryReloadsModified){
+    const std::string path = tempTGA("astro_registry_mod.tga", 40);
+    AssetRegistry registry;
+    const std::shared_ptr<Texture> before = registry.texture(path);
+
+    // New content (and a later mtime): a new instance, the old one stays valid for its holders
+    tempTGA("astro_registry_mod.tga", 50);
+    std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) + std::chrono::seconds(5));
+    const std::shared_ptr<Texture> after = registry.texture(path);
+    ASSERT_TRUE(before != after);
+    ASSERT_EQ(getPixel(*before, 0, 0).x, 40);
+    ASSERT_EQ(getPixel(*after, 0, 0).x, 50);
+
+    // Modified between the lookup (hash of the shade 50 content) and the load: the asset is
+    // returned, but neither registered as that content nor reused by the next request
+    AssetRegistry racing(true);
+    const std::shared_ptr<Texture> during = racing.get<Texture>(path, [](const std::string& file) {
+        tempTGA("astro_registry_mod.tga", 70);
+        std::filesystem::last_write_time(file, std::filesystem::last_write_time(file) + std::chrono::seconds(5));
+        return TGAImage::readImage(file);
+    });
+    ASSERT_EQ(getPixel(*during, 0, 0).x, 70);
+    const std::string copy = tempTGA("astro_registry_mod_copy.tga", 50);
+    ASSERT_EQ(getPixel(*racing.texture(copy), 0, 0).x, 50);
+    ASSERT_TRUE(racing.texture(path) != during);
+
+    // Missing files
+    try {
+        registry.texture("/nonexistent/astro_missing.tga");
+        ASSERT_TRUE(false);
+    } catch (std::runtime_error& e) {
+        ASSERT_TRUE(true);
+    }
+    return true;
+}
+
+TEST(registryWithLoader){
+    const std::string path = tempTGA("astro_registry_async.tga", 60);
+    AssetRegistry registry;
+    AssetLoader loader(2, &registry);
+    AssetHandle<Texture> handles[4];
+    for (auto& handle : handles) handle = loader.loadImage(path);
+
+    // Every job returns the registered instance, even when they loaded concurrently
+    const std::shared_ptr<Texture> shared = registry.texture(path);
+    for (auto& handle : handles) ASSERT_TRUE(handle.get() == shared);
+    ASSERT_EQ(registry.liveCount(), 1);
+    return true;
+}
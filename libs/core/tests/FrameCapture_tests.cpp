@@ -0,0 +1,182 @@
+#include "astro/core/io/FrameCapture.hpp"
+#include "astro/core/platform/HeadlessLayer.hpp"
+#include "astro_test.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace astro::core::io;
+using namespace astro::graphics;
+
+namespace {
+    std::vector<uint8_t> readAll(const std::string& path) {
+        std::ifstream fs(path, std::ios_base::binary);
+        return std::vector<uint8_t>(std::istreambuf_iterator<char>(fs), std::istreambuf_iterator<char>());
+    }
+
+    // Reference BT.601 limited range conversion of one pixel / one 2x2 block sum
+    uint8_t refY(const Color& c) { return uint8_t(((66 * c[0] + 129 * c[1] + 25 * c[2] + 128) >> 8) + 16); }
+    uint8_t refU(int r, int g, int b) { return uint8_t(((-38 * r - 74 * g + 112 * b + 512) >> 10) + 128); }
+    uint8_t refV(int r, int g, int b) { return uint8_t(((112 * r - 94 * g - 18 * b + 512) >> 10) + 128); }
+}
+
+TEST(captureI420Conversion){
+    // 37x9: SIMD blocks, scalar tails, odd last column and row
+    Texture image(37, 9);
+    for (int y = 0; y < image.height; y++)
+        for (int x = 0; x < image.width; x++) {
+            Color c(uint8_t(x * 7 + y), uint8_t(255 - x * 3), uint8_t((x * y * 13) & 0xFF));
+            putPixel(image, x, y, c);
+        }
+
+    const int cw = 19, ch = 5;
+    std::vector<uint8_t> yPlane(37 * 9), uPlane(cw * ch), vPlane(cw * ch);
+    FrameCapture::rgbaToI420(image.data.data(), 37, 9, yPlane.data(), uPlane.data(), vPlane.data());
+
+    for (int y = 0; y < 9; y++)
+        for (int x = 0; x < 37; x++) ASSERT_EQ(yPlane[y * 37 + x], refY(getPixel(image, x, y)));
+    for (int y = 0; y < ch; y++)
+        for (int x = 0; x < cw; x++) {
+            int sum[3] = {0, 0, 0};
+            for (int dy = 0; dy < 2; dy++)
+                for (int dx = 0; dx < 2; dx++) {
+                    const Color c = getPixel(image, std::min(2 * x + dx, 36), std::min(2 * y + dy, 8));
+                    for (int k = 0; k < 3; k++) sum[k] += c[k];
+                }
+            ASSERT_EQ(uPlane[y * cw + x], refU(sum[0], sum[1], sum[2]));
+            ASSERT_EQ(vPlane[y * cw + x], refV(sum[0], sum[1], sum[2]));
+        }
+
+    // Range limits
+    Texture white(8, 2);
+    Color whiteColor(255, 255, 255);
+    clearTexture(white, whiteColor);
+    FrameCapture::rgbaToI420(white.data.data(), 8, 2, yPlane.data(), uPlane.data(), vPlane.data());
+    ASSERT_EQ(yPlane[0], 235);
+    ASSERT_EQ(uPlane[0], 128);
+    ASSERT_EQ(vPlane[0], 128);
+    return true;
+}
+
+TEST(captureY4M){
+    const std::string path = (std::filesystem::temp_directory_path() / "astro_capture.y4m").string();
+    Texture frame(6, 4);
+    FrameCapture::Options options;
+    options.blockWhenFull = true;
+    options.ringLength = 2;
+    options.fps = 30;
+
+    FrameCapture capture;
+    capture.open(path, 6, 4, options);
+    for (int i = 0; i < 5; i++) {
+        Color red(uint8_t(i * 50), 0, 0);
+        clearTexture(frame, red);
+        ASSERT_TRUE(capture.submit(frame));
+    }
+    capture.flush();
+    ASSERT_EQ(capture.writtenFrames(), 5);
+    ASSERT_EQ(capture.droppedFrames(), 0);
+    capture.close();
+    ASSERT_FALSE(capture.isOpen());
+
+    const std::string header = "YUV4MPEG2 W6 H4 F30:1 Ip A1:1 C420jpeg\n";
+    const size_t frameBytes = 6 + 6 * 4 + 2 * 3 * 2;
+    const std::vector<uint8_t> bytes = readAll(path);
+    ASSERT_EQ(bytes.size(), header.size() + 5 * frameBytes);
+    ASSERT_TRUE(std::memcmp(bytes.data(), header.data(), header.size()) == 0);
+    for (int i = 0; i < 5; i++) {
+        const uint8_t* f = bytes.data() + header.size() + i * frameBytes;
+        ASSERT_TRUE(std::memcmp(f, "FRAME\n", 6) == 0);
+        // Frames are written in submission order
+        ASSERT_EQ(f[6], refY(Color(uint8_t(i * 50), 0, 0)));
+    }
+
+    // Wrong frame size
+    try {
+        capture.open(path, 6, 4, options);
+        capture.submit(Texture(4, 4));
+        ASSERT_TRUE(false);
+    } catch (std::runtime_error& e) {
+        ASSERT_TRUE(true);
+    }
+    return true;
+}
+
+TEST(captureRawDropsWhenFull){
+    const std::string path = (std::filesystem::temp_directory_path() / "astro_capture.rgb").string();
+    FrameCapture::Options options;
+    options.format = FrameCapture::Format::RawRGB;
+    options.ringLength = 1;
+
+    // A large frame and a single buffer: submissions outpace the writer and are dropped, not queued
+    Texture frame(512, 512);
+    Color color(1, 2, 3);
+    clearTexture(frame, color);
+    FrameCapture capture;
+    capture.open(path, 512, 512, options);
+    size_t accepted = 0;
+    for (int i = 0; i < 50; i++) accepted += capture.submit(frame) ? 1 : 0;
+    capture.flush();
+    ASSERT_EQ(capture.submittedFrames(), 50);
+    ASSERT_EQ(capture.writtenFrames(), accepted);
+    ASSERT_EQ(capture.droppedFrames(), 50 - accepted);
+    capture.close();
+
+    const std::vector<uint8_t> bytes = readAll(path);
+    ASSERT_EQ(bytes.size(), accepted * 512 * 512 * 3);
+    ASSERT_EQ(bytes[0], 1);
+    ASSERT_EQ(bytes[1], 2);
+    ASSERT_EQ(bytes[2], 3);
+    return true;
+}
+
+TEST(captureWriterError){
+    // A failed write (disk full) is reported by the next calls, the capture stays open until closed
+    if (!std::filesystem::exists("/dev/full")) return true;
+    FrameCapture::Options options;
+    options.blockWhenFull = true;
+    FrameCapture capture;
+    capture.open("/dev/full", 256, 256, options);
+    Texture frame(256, 256);
+    try {
+        for (int i = 0; i < 8; i++) capture.submit(frame);
+        capture.flush();
+        ASSERT_TRUE(false);
+    } catch (std::runtime_error& e) {
+        ASSERT_TRUE(true);
+    }
+    ASSERT_TRUE(capture.isOpen());
+    try {
+        capture.submit(frame);
+        ASSERT_TRUE(false);
+    } catch (std::runtime_error& e) {
+        ASSERT_TRUE(true);
+    }
+    capture.close();
+    ASSERT_FALSE(capture.isOpen());
+    return true;
+}
+
+TEST(captureHeadless){
+    using namespace astro::core::platform;
+    const std::string path = (std::filesystem::temp_directory_path() / "astro_headless.y4m").string();
+    HeadlessLayer::Options options;
+    options.capturePath = path;
+    options.capture.blockWhenFull = true;
+    HeadlessLayer console(options);
+    console.initialize({"headless", 16, 8, 24, LayerEventType::EvtNone});
+    for (int i = 0; i < 3; i++) console.present(console.acquireCanvas());
+    console.getCapture().flush();
+    ASSERT_EQ(console.getCapture().writtenFrames(), 3);
+    console.close();
+
+    const size_t frameBytes = 6 + 16 * 8 + 2 * 8 * 4;
+    ASSERT_EQ(std::filesystem::file_size(path), std::string("YUV4MPEG2 W16 H8 F60:1 Ip A1:1 C420jpeg\n").size() + 3 * frameBytes);
+    return true;
+}
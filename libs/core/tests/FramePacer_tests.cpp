@@ -0,0 +1,53 @@
+#include "astro/core/timing/FramePacer.hpp"
+#include "astro_test.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+using namespace astro::core::timing;
+
+TEST(framePacerTargetRate){
+    // 20 frames at 200 fps can not take less than 100 ms
+    FramePacer pacer(200.0);
+    const auto start = FramePacer::Clock::now();
+    for (int i = 0; i < 20; i++) pacer.endFrame();
+    const double elapsedMs = std::chrono::duration<double, std::milli>(FramePacer::Clock::now() - start).count();
+    ASSERT_TRUE(elapsedMs >= 95.0);
+
+    // Only the remaining budget is waited
+    FramePacer busyPacer(100.0);
+    for (int i = 0; i < 5; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(6));
+        busyPacer.endFrame();
+    }
+    const FrameStats stats = busyPacer.getStats();
+    ASSERT_EQ(stats.frames, 5);
+    ASSERT_TRUE(stats.minFrameMs >= 6.0);
+    ASSERT_TRUE(stats.avgFrameMs >= 9.0 && stats.avgFrameMs < 20.0); // Deadlines absorb jitter on average
+    return true;
+}
+
+TEST(framePacerStats){
+    FramePacer pacer(0.0); // Unthrottled
+    ASSERT_EQ(pacer.getStats().frames, 0);
+    for (int i = 0; i < FramePacer::HISTORY_LENGTH + 10; i++) {
+        pacer.addSectionTime(FrameSection::Update, std::chrono::milliseconds(1));
+        pacer.addSectionTime(FrameSection::Render, std::chrono::milliseconds(2));
+        pacer.addSectionTime(FrameSection::Render, std::chrono::milliseconds(2));
+        {
+            auto present = pacer.section(FrameSection::Present);
+        }
+        pacer.endFrame();
+    }
+
+    const FrameStats stats = pacer.getStats();
+    ASSERT_EQ(stats.frames, FramePacer::HISTORY_LENGTH); // Rolling window
+    ASSERT_TRUE(stats.minFrameMs <= stats.avgFrameMs);
+    ASSERT_TRUE(stats.avgFrameMs <= stats.p99FrameMs || stats.p99FrameMs == stats.maxFrameMs);
+    ASSERT_TRUE(stats.p99FrameMs <= stats.maxFrameMs);
+    ASSERT_TRUE(std::abs(stats.avgUpdateMs - 1.0) < 1e-6);
+    ASSERT_TRUE(std::abs(stats.avgRenderMs - 4.0) < 1e-6);
+    ASSERT_TRUE(stats.avgPresentMs >= 0.0);
+    return true;
+}
@@ -0,0 +1,67 @@
+#include "astro/core/platform/HeadlessLayer.hpp"
+#include "astro/core/platform/PlatformFactory.hpp"
+#include "astro/graphics/graphics.hpp"
+#include "astro_test.hpp"
+
+#include <filesystem>
+#include <memory>
+
+using namespace astro::core::platform;
+using namespace astro::graphics;
+
+TEST(headlessFactory){
+    const auto console = PlatformFactory::getPlatform(PlatformType::Headless);
+    ASSERT_TRUE(dynamic_cast<HeadlessLayer*>(console.get()) != nullptr);
+    return true;
+}
+
+TEST(headlessPresent){
+    HeadlessLayer::Options options;
+    options.recordFrameTimes = true;
+    HeadlessLayer console(options);
+    LayerConfig layerConfig = {"headless", 32, 16, 24, LayerEventType::EvtNone};
+    layerConfig.asyncPresent = true;
+    console.initialize(layerConfig);
+    
+    Color red(255, 0, 0);
+    Color blue(0, 0, 255);
+    for (int i = 0; i < 10; i++) {
+        Texture& canvas = console.acquireCanvas();
+        if (i == 0) clearTexture(canvas, red);
+        draw2dLine(canvas, i, 0, i, 15, blue);
+        console.present(canvas);
+    }
+    ASSERT_EQ(console.getFrameCount(), 10);
+    ASSERT_EQ(console.getFrameTimestamps().size(), 10);
+
+    // The front buffer shows the accumulated damage
+    const Texture& front = console.getFrontBuffer();
+    ASSERT_EQ(getPixel(front, 5, 8), blue);
+    ASSERT_EQ(getPixel(front, 20, 8), red);
+
+    // Compatibility path presents the whole texture
+    Texture external(32, 16);
+    clearDamage(external);
+    console.render(external);
+    ASSERT_EQ(getPixel(console.getFrontBuffer(), 20, 8), Color(0, 0, 0));
+    return true;
+}
+
+TEST(headlessFrameDump){
+    const std::filesystem::path dir = std::filesystem::temp_directory_path() / "astro_headless_dump";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+
+    HeadlessLayer::Options options;
+    options.dumpDirectory = dir.string();
+    options.dumpEvery = 2;
+    HeadlessLayer console(options);
+    console.initialize({"headless", 8, 8, 24, LayerEventType::EvtNone});
+    for (int i = 0; i < 4; i++) console.present(console.acquireCanvas());
+
+    ASSERT_TRUE(std::filesystem::exists(dir / "frame_000000.ppm"));
+    ASSERT_FALSE(std::filesystem::exists(dir / "frame_000001.ppm"));
+    ASSERT_TRUE(std::filesystem::exists(dir / "frame_000002.ppm"));
+    std::filesystem::remove_all(dir);
+    return true;
+}
@@ -0,0 +1,108 @@
+#include "astro/core/io/MeshFile.hpp"
+#include "astro_test.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace astro::core::io;
+using namespace astro::math;
+
+static std::string writeTempFile(const std::string& name, const std::string& text) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+    std::ofstream fs(path, std::ios_base::trunc | std::ios_base::binary);
+    fs << text;
+    return path.string();
+}
+
+TEST(meshFileRoundTrip){
+    std::vector<astro::graphics::VertexAttributes> vertices(3);
+    vertices[0].pos = Vec4f(-1.0f, 0.0f, 2.0f, 1.0f);
+    vertices[1].pos = Vec4f(1.0f, 3.0f, 0.0f, 1.0f);
+    vertices[2].pos = Vec4f(0.0f, -2.0f, 1.0f, 1.0f);
+    for (auto& v : vertices) { v.uv = Vec2f(0.5f); v.normal = Vec3f(0.0f, 0.0f, 1.0f); }
+    const std::vector<uint32_t> indices = {0, 1, 2};
+
+    const std::string path = (std::filesystem::temp_directory_path() / "astro_roundtrip.astromesh").string();
+    MeshFile::write(path, vertices, indices);
+    const MeshFile mesh(path);
+
+    ASSERT_TRUE(mesh.isMapped());
+    ASSERT_EQ(mesh.vertices().size(), 3);
+    ASSERT_EQ(mesh.indices().size(), 3);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(mesh.vertices().data()) % MeshFile::ALIGNMENT, 0);
+    ASSERT_TRUE(mesh.vertices()[1].pos == vertices[1].pos);
+    ASSERT_TRUE(mesh.vertices()[2].normal == vertices[2].normal);
+    ASSERT_EQ(mesh.indices()[2], 2);
+    ASSERT_TRUE(mesh.boundsMin() == Vec3f(-1.0f, -2.0f, 0.0f));
+    ASSERT_TRUE(mesh.boundsMax() == Vec3f(1.0f, 3.0f, 2.0f));
+
+    // Not a mesh / truncated
+    const std::string bad = writeTempFile("astro_bad.astromesh", "ASTROMSH but too short");
+    try {
+        MeshFile invalid(bad);
+        ASSERT_TRUE(false);
+    } catch (std::runtime_error &e) {
+        ASSERT_TRUE(true);
+    }
+    return true;
+}
+
+TEST(meshFileOBJCache){
+    const std::string objPath = writeTempFile("astro_cached.obj", "v 0 0 0\nv 1 0 0\nv 0 1 0\nvt 0 0\nvt 1 0\nvt 0 1\nf 1/1 2/2 3/3\n");
+    const std::string cachePath = MeshFile::cachePath(objPath);
+    std::filesystem::remove(cachePath);
+
+    // First load parses and writes the cache, the second one maps it
+    const MeshFile parsed = MeshFile::loadOBJ(objPath, 1);
+    ASSERT_TRUE(std::filesystem::exists(cachePath));
+    ASSERT_EQ(parsed.indices().size(), 3);
+    const auto cacheTime = std::filesystem::last_write_time(cachePath);
+
+    const MeshFile cached = MeshFile::loadOBJ(objPath, 1);
+    ASSERT_TRUE(cached.isMapped());
+    ASSERT_TRUE(std::filesystem::last_write_time(cachePath) == cacheTime);
+    ASSERT_EQ(cached.vertices().size(), parsed.vertices().size());
+    ASSERT_EQ(std::memcmp(cached.vertices().data(), parsed.vertices().data(), parsed.vertices().size_bytes()), 0);
+    ASSERT_TRUE(cached.vertices()[1].tangent == Vec3f(1.0f, 0.0f, 0.0f));
+
+    // Same content with a new mtime: still valid (hash)
+    std::filesystem::last_write_time(objPath, cacheTime + std::chrono::seconds(5));
+    const MeshFile touched = MeshFile::loadOBJ(objPath, 1);
+    ASSERT_EQ(touched.source().mtime, std::filesystem::last_write_time(objPath).time_since_epoch().count());
+
+    // Edited source: rebuilt
+    writeTempFile("astro_cached.obj", "v 0 0 0\nv 2 0 0\nv 0 2 0\nv 2 2 0\nf 1 2 3\nf 2 4 3\n");
+    const MeshFile rebuilt = MeshFile::loadOBJ(objPath, 1);
+    ASSERT_EQ(rebuilt.indices().size(), 6);
+    ASSERT_TRUE(rebuilt.boundsMax() == Vec3f(2.0f, 2.0f, 0.0f));
+    return true;
+}
+
+TEST(meshFileConcurrentBuild){
+    // Loads racing to build the same cache each write their own temporary file
+    std::string text;
+    for (int i = 0; i < 2000; i++) text += "v " + std::to_string(i) + " 0 0\n";
+    for (int i = 1; i + 2 <= 2000; i++) text += "f " + std::to_string(i) + " " + std::to_string(i + 1) + " " + std::to_string(i + 2) + "\n";
+    const std::string objPath = writeTempFile("astro_concurrent.obj", text);
+    const std::string cachePath = MeshFile::cachePath(objPath);
+
+    for (int round = 0; round < 4; round++) {
+        std::filesystem::remove(cachePath);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; t++) threads.emplace_back([&] { MeshFile::loadOBJ(objPath, 1); });
+        for (std::thread& thread : threads) thread.join();
+
+        const MeshFile cached(cachePath);
+        ASSERT_EQ(cached.indices().size(), 1998 * 3);
+        ASSERT_TRUE(cached.boundsMax() == Vec3f(1999.0f, 0.0f, 0.0f));
+    }
+    for (const auto& entry : std::filesystem::directory_iterator(std::filesystem::temp_directory_path())) {
+        ASSERT_TRUE(entry.path().filename().string().rfind("astro_concurrent.astromesh.tmp", 0) != 0);
+    }
+    return true;
+}
@@ -0,0 +1,138 @@
+#include "astro/core/io/OBJFile.hpp"
+#include "astro_test.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+using namespace astro::core::io;
+using namespace astro::math;
+
+static std::string writeTempOBJ(const std::string& name, const std::string& text) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+    std::ofstream fs(path, std::ios_base::trunc | std::ios_base::binary);
+    fs << text;
+    return path.string();
+}
+
+TEST(objParseFormats){
+    // Comments, ignored statements, CRLF line ends, every corner syntax and negative indices
+    const std::string path = writeTempOBJ("astro_obj_formats.obj",
+        "# Test mesh\r\n"
+        "mtllib test.mtl\r\n"
+        "o quad\r\n"
+        "v 0 0 0\r\n"
+        "v 1.0 0 0\r\n"
+        "v 1 1 0\r\n"
+        "v +0 1e0 -0.0\r\n"
+        "vt 0 0\r\n"
+        "vt 1 0\r\n"
+        "vt 1 1\r\n"
+        "vt 0 1\r\n"
+        "vn 0 0 1\r\n"
+        "usemtl default\r\n"
+        "s off\r\n"
+        "f 1/1/1 2/2/1 3/3/1 4/4/1\r\n"   // Quad, fan triangulated
+        "f -4/-4/-1 -2/-2/-1 -1/-1/-1\r\n" // Relative indices, same corners as above
+        "f 1//1 2//1 3//1\r\n"             // No texcoords: new vertices
+        "f 1/1 3/3 4/4\n"                  // No normals
+        "f 1 2 3");                        // Positions only, no final newline
+    const OBJFile obj(path);
+
+    ASSERT_EQ(obj.indices.size(), 18);
+    ASSERT_EQ(obj.vertices.size(), 4 + 3 + 3 + 3);
+    ASSERT_EQ(obj.indices[0], 0); ASSERT_EQ(obj.indices[1], 1); ASSERT_EQ(obj.indices[2], 2);
+    ASSERT_EQ(obj.indices[3], 0); ASSERT_EQ(obj.indices[4], 2); ASSERT_EQ(obj.indices[5], 3);
+    ASSERT_EQ(obj.indices[6], 0); ASSERT_EQ(obj.indices[7], 2); ASSERT_EQ(obj.indices[8], 3); // Deduplicated
+
+    ASSERT_TRUE(obj.vertices[3].pos == Vec4f(0.0f, 1.0f, 0.0f, 1.0f));
+    ASSERT_TRUE(obj.vertices[2].uv == Vec2f(1.0f, 1.0f));
+    ASSERT_TRUE(obj.vertices[2].normal == Vec3f(0.0f, 0.0f, 1.0f));
+    ASSERT_TRUE(obj.vertices[4].uv == Vec2f(0.0f));
+    ASSERT_TRUE(obj.vertices[7].normal == Vec3f(0.0f));
+
+    // Tangents follow +u on the textured quad
+    ASSERT_TRUE(std::abs(obj.vertices[0].tangent.x - 1.0f) < 1e-5f);
+    ASSERT_TRUE(std::abs(obj.vertices[0].tangent.y) < 1e-5f);
+    return true;
+}
+
+TEST(objParseErrors){
+    // Missing files and out of range indices throw
+    try {
+        OBJFile obj(std::filesystem::temp_directory_path() / "astro_obj_missing.obj");
+        ASSERT_TRUE(false);
+    } catch (std::runtime_error &e) {
+        ASSERT_TRUE(true);
+    }
+    const std::string path = writeTempOBJ("astro_obj_range.obj", "v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 4\n");
+    try {
+        OBJFile obj(path);
+        ASSERT_TRUE(false);
+    } catch (std::runtime_error &e) {
+        ASSERT_TRUE(true);
+    }
+
+    // Relative indices one before the first element (-(defined + 1))
+    for (const std::string& text : {std::string("v 0 0 0\nv 1 0 0\nv 0 1 0\nf -4 1 2\n"),
+                                    std::string("v 0 0 0\nv 1 0 0\nv 0 1 0\nvt 0 0\nf 1/-2 2/1 3/1\n"),
+                                    std::string("v 0 0 0\nv 1 0 0\nv 0 1 0\nvn 0 0 1\nf 1//-2 2//1 3//1\n")}) {
+        try {
+            OBJFile relative;
+            relative.loadFromMemory(text.data(), text.size(), 1);
+            ASSERT_TRUE(false);
+        } catch (std::runtime_error &e) {
+            ASSERT_TRUE(true);
+        }
+    }
+
+    // Degenerate faces are skipped
+    const std::string degenerate = "v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2\nf 1 2 3\n";
+    OBJFile obj;
+    obj.loadFromMemory(degenerate.data(), degenerate.size());
+    ASSERT_EQ(obj.indices.size(), 3);
+    return true;
+}
+
+TEST(objParallelMatchesSerial){
+    // Several MB so the text is split in chunks: strips defined and referenced incrementally
+    // (relative indices cross chunk boundaries) plus faces sharing the first vertices of the file
+    std::string text;
+    for (int strip = 0; strip < 40000; strip++) {
+        for (int k = 0; k < 4; k++)
+            text += "v " + std::to_string(strip * 0.25f) + " " + std::to_string(k) + " 0.5\nvt 0." + std::to_string(k) + " 0.75\n";
+        text += "vn 0 0 1\n";
+        text += "f -4/-4/-1 -3/-3/-1 -2/-2/-1 -1/-1/-1\n";
+        if (strip % 7 == 0) text += "f 1/1/1 2/2/1 " + std::to_string(strip * 4 + 3) + "/3/1\n";
+    }
+
+    OBJFile serial, parallel;
+    serial.loadFromMemory(text.data(), text.size(), 1);
+    parallel.loadFromMemory(text.data(), text.size(), 4);
+
+    ASSERT_EQ(serial.indices.size(), (40000 * 2 + 5715) * 3);
+    ASSERT_TRUE(serial.indices == parallel.indices);
+    ASSERT_EQ(serial.vertices.size(), parallel.vertices.size());
+    for (size_t i = 0; i < serial.vertices.size(); i++) {
+        ASSERT_TRUE(serial.vertices[i].pos == parallel.vertices[i].pos);
+        ASSERT_TRUE(serial.vertices[i].uv == parallel.vertices[i].uv);
+        ASSERT_TRUE(serial.vertices[i].normal == parallel.vertices[i].normal);
+        ASSERT_TRUE(serial.vertices[i].tangent == parallel.vertices[i].tangent);
+    }
+
+    // Errors report the global line number whichever chunk they are in
+    const std::string bad = text + "f 1 2 999999\n";
+    for (unsigned threads : {1u, 4u}) {
+        try {
+            parallel.loadFromMemory(bad.data(), bad.size(), threads);
+            ASSERT_TRUE(false);
+        } catch (std::runtime_error &e) {
+            const size_t lines = static_cast<size_t>(std::count(bad.begin(), bad.end(), '\n'));
+            ASSERT_TRUE(std::string(e.what()).find("line " + std::to_string(lines)) != std::string::npos);
+        }
+    }
+    return true;
+}
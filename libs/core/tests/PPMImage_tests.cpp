@@ -0,0 +1,57 @@
+#include "astro/core/io/PPMImage.hpp"
+#include "astro_test.hpp"
+
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+using namespace astro::core::io;
+using namespace astro::graphics;
+
+TEST(ppmWriteRead){
+    // 37 pixels per row: SIMD blocks and scalar tails
+    Texture image(37, 9);
+    for (int y = 0; y < image.height; y++)
+        for (int x = 0; x < image.width; x++) {
+            Color c(uint8_t(x * 5), uint8_t(y * 20), uint8_t(x ^ y));
+            putPixel(image, x, y, c);
+        }
+    const std::string path = (std::filesystem::temp_directory_path() / "astro_roundtrip.ppm").string();
+    PPMImage::writeImage(path, image);
+    ASSERT_EQ(std::filesystem::file_size(path), std::string("P6 37 9 255\n").size() + 37 * 9 * 3);
+
+    const Texture read = PPMImage::readImage(path);
+    ASSERT_EQ(read.width, 37);
+    ASSERT_EQ(read.height, 9);
+    ASSERT_TRUE(read.data == image.data);
+
+    // Wrong extension
+    try {
+        PPMImage::writeImage(path + ".tga", image);
+        ASSERT_TRUE(false);
+    } catch (std::runtime_error &e) {
+        ASSERT_TRUE(true);
+    }
+    return true;
+}
+
+TEST(ppmReadHeader){
+    // Comments and any whitespace between the fields
+    const std::string text = std::string("P6\n# made by hand\n2\t1 # size\n255\n") + "\x01\x02\x03\xFA\xFB\xFC";
+    const Texture image = PPMImage::readImageFromMemory(reinterpret_cast<const uint8_t*>(text.data()), text.size());
+    ASSERT_EQ(image.width, 2);
+    ASSERT_TRUE(getPixel(image, 0, 0) == Color(1, 2, 3, 255));
+    ASSERT_TRUE(getPixel(image, 1, 0) == Color(250, 251, 252, 255));
+
+    // ASCII PPMs, 16-bit images and truncated data are rejected
+    for (const std::string& bad : {std::string("P3 1 1 255\n0 0 0"), std::string("P6 1 1 65535\n\x01\x02\x03\x04\x05\x06"),
+                                  std::string("P6 2 1 255\n\x01\x02\x03")}) {
+        try {
+            PPMImage::readImageFromMemory(reinterpret_cast<const uint8_t*>(bad.data()), bad.size());
+            ASSERT_TRUE(false);
+        } catch (std::runtime_error &e) {
+            ASSERT_TRUE(true);
+        }
+    }
+    return true;
+}
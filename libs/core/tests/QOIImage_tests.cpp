@@ -0,0 +1,117 @@
+#include "astro/core/io/AssetRegistry.hpp"
+#include "astro/core/io/QOIImage.hpp"
+#include "astro_test.hpp"
+
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace astro::core::io;
+using namespace astro::graphics;
+
+TEST(qoiKnownBytes){
+    // A run of the initial pixel, a small difference and a full RGB pixel
+    Texture image(4, 1);
+    Color c0(0, 0, 0), c1(1, 1, 1), c2(10, 20, 30);
+    putPixel(image, 0, 0, c0);
+    putPixel(image, 1, 0, c0);
+    putPixel(image, 2, 0, c1);
+    putPixel(image, 3, 0, c2);
+
+    const std::vector<uint8_t> expected = {
+        'q', 'o', 'i', 'f', 0, 0, 0, 4, 0, 0, 0, 1, 3, 0,
+        0xC1,                   // OP_RUN, 2 pixels
+        0x7F,                   // OP_DIFF (+1, +1, +1)
+        0xFE, 10, 20, 30,       // OP_RGB
+        0, 0, 0, 0, 0, 0, 0, 1  // End marker
+    };
+    ASSERT_TRUE(QOIImage::encode(image) == expected);
+
+    const Texture decoded = QOIImage::readImageFromMemory(expected.data(), expected.size());
+    ASSERT_TRUE(decoded.data == image.data);
+    return true;
+}
+
+TEST(qoiRoundTrip){
+    // Flat areas (runs longer than 62), gradients (DIFF/LUMA), a repeating palette (INDEX),
+    // noise with alpha (RGBA), odd size
+    Texture image(157, 61);
+    uint32_t seed = 12345;
+    for (int y = 0; y < image.height; y++)
+        for (int x = 0; x < image.width; x++) {
+            seed = seed * 1664525u + 1013904223u;
+            Color c(0, 0, 0);
+            if (y < 10) c = Color(40, 80, 120);
+            else if (y < 25) c = Color(uint8_t(x), uint8_t(x * 2 + y), uint8_t(y * 3));
+            else if (y < 40) c = Color(uint8_t((x % 5) * 50), uint8_t((x % 3) * 80), 7);
+            else c = Color(uint8_t(seed >> 24), uint8_t(seed >> 16), uint8_t(seed >> 8), uint8_t(seed));
+            putPixel(image, x, y, c);
+        }
+
+    const std::string path = (std::filesystem::temp_directory_path() / "astro_roundtrip.qoi").string();
+    QOIImage::writeImage(path, image);
+    ASSERT_TRUE(std::filesystem::file_size(path) < image.data.size() * 4);
+    const Texture read = QOIImage::readImage(path);
+    ASSERT_EQ(read.width, 157);
+    ASSERT_EQ(read.height, 61);
+    ASSERT_TRUE(read.data == image.data);
+    ASSERT_TRUE(AssetRegistry::readImage(path).data == image.data); // Picked by extension
+
+    // Opaque images declare 3 channels
+    Texture opaque(3, 3);
+    Color gray(100, 100, 100);
+    clearTexture(opaque, gray);
+    ASSERT_EQ(QOIImage::encode(opaque)[12], 3);
+    ASSERT_EQ(QOIImage::encode(image)[12], 4);
+    return true;
+}
+
+TEST(qoiRunAcrossRows){
+    // Row 0 fills with RGBA pixels and ends in a run, flushed by the first (RGBA) pixel of
+    // row 1: the worst case of both rows must still leave room for the end marker
+    Texture image(40, 2);
+    uint32_t seed = 777;
+    for (int y = 0; y < image.height; y++)
+        for (int x = 0; x < image.width; x++) {
+            seed = seed * 1664525u + 1013904223u;
+            Color c(uint8_t(seed >> 24), uint8_t(seed >> 16), uint8_t(seed >> 8), uint8_t(x + y * 64));
+            if (y == 0 && x == image.width - 1) c = getPixel(image, x - 1, y);
+            putPixel(image, x, y, c);
+        }
+
+    const std::vector<uint8_t> bytes = QOIImage::encode(image);
+    const std::vector<uint8_t> marker = {0, 0, 0, 0, 0, 0, 0, 1};
+    ASSERT_TRUE(std::vector<uint8_t>(bytes.end() - 8, bytes.end()) == marker);
+    ASSERT_TRUE(QOIImage::readImageFromMemory(bytes.data(), bytes.size()).data == image.data);
+    return true;
+}
+
+TEST(qoiInvalid){
+    Texture image(16, 16);
+    Color c(1, 2, 3);
+    clearTexture(image, c);
+    std::vector<uint8_t> bytes = QOIImage::encode(image);
+
+    // Truncated pixel data, bad magic, zero size
+    std::vector<std::vector<uint8_t>> bad = {bytes, bytes, bytes};
+    bad[0].resize(QOIImage::QOI_HEADER_SIZE + QOIImage::QOI_PADDING_SIZE);
+    bad[1][0] = 'x';
+    bad[2][7] = 0;
+    for (const auto& data : bad) {
+        try {
+            QOIImage::readImageFromMemory(data.data(), data.size());
+            ASSERT_TRUE(false);
+        } catch (std::runtime_error& e) {
+            ASSERT_TRUE(true);
+        }
+    }
+
+    try {
+        QOIImage::readImage("/nonexistent/astro_missing.qoi");
+        ASSERT_TRUE(false);
+    } catch (std::runtime_error& e) {
+        ASSERT_TRUE(true);
+    }
+    return true;
+}
@@ -0,0 +1,103 @@
+#include "astro/core/platform/SwapChain.hpp"
+#include "astro/graphics/graphics.hpp"
+#include "astro_test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace astro::core::platform;
+using namespace astro::graphics;
+
+TEST(swapChainSyncPresent){
+    std::vector<uint8_t> presented;
+    SwapChain chain;
+    chain.initialize(4, 4, 3, false, [&presented](const Texture& canvas){
+        presented.push_back(canvas.data[0].r);
+    });
+    ASSERT_EQ(chain.length(), 1);
+
+    for (uint8_t i = 0; i < 5; ++i) {
+        Texture& canvas = chain.acquire();
+        Color col(i, 0, 0);
+        clearTexture(canvas, col);
+        chain.present(canvas);
+    }
+    ASSERT_EQ(presented.size(), 5);
+    for (uint8_t i = 0; i < 5; ++i) ASSERT_EQ((int)presented[i], (int)i);
+    return true;
+}
+
+TEST(swapChainAsyncPresent){
+    std::vector<uint8_t> presented;
+    SwapChain chain;
+    chain.initialize(4, 4, 3, true, [&presented](const Texture& canvas){
+        std::this_thread::sleep_for(std::chrono::milliseconds(1)); // Slow display
+        presented.push_back(canvas.data[0].r);
+    });
+    ASSERT_EQ(chain.length(), 3);
+
+    // Frames are presented in order and no canvas is handed out twice
+    const int frames = 50;
+    for (int i = 0; i < frames; ++i) {
+        Texture& canvas = chain.acquire();
+        Color col(static_cast<uint8_t>(i), 0, 0);
+        clearTexture(canvas, col);
+        chain.present(canvas);
+    }
+    chain.flush();
+    ASSERT_EQ(presented.size(), frames);
+    for (int i = 0; i < frames; ++i) ASSERT_EQ((int)presented[i], i);
+
+    // Presenting a foreign canvas is an error
+    Texture foreign(4, 4);
+    try {
+        chain.present(foreign);
+        ASSERT_TRUE(false);
+    } catch (std::runtime_error& e) {
+        ASSERT_TRUE(true);
+    }
+    return true;
+}
+
+TEST(swapChainDamageCopyForward){
+    std::vector<long> presentedArea;
+    SwapChain chain;
+    chain.initialize(16, 16, 3, true, [&presentedArea](const Texture& canvas){
+        presentedArea.push_back(damagedArea(canvas));
+    });
+    Color white(255, 255, 255);
+
+    // Only a moving pixel is drawn each frame, the rest must be carried over
+    for (int i = 0; i < 10; ++i) {
+        Texture& canvas = chain.acquire();
+        ASSERT_EQ(damagedArea(canvas), 0);
+        putPixel(canvas, i, i, white);
+        markDamaged(canvas, i, i, 1, 1);
+        chain.present(canvas);
+    }
+    chain.flush();
+    for (long area : presentedArea) ASSERT_EQ(area, 1);
+
+    Texture& canvas = chain.acquire();
+    for (int i = 0; i < 10; ++i) ASSERT_EQ(getPixel(canvas, i, i), white);
+    ASSERT_EQ(getPixel(canvas, 10, 10), Color(0, 0, 0));
+    return true;
+}
+
+TEST(swapChainPresenterError){
+    SwapChain chain;
+    chain.initialize(4, 4, 2, true, [](const Texture&){
+        throw std::runtime_error("display lost");
+    });
+    chain.present(chain.acquire());
+    try {
+        chain.flush();
+        ASSERT_TRUE(false);
+    } catch (std::runtime_error& e) {
+        ASSERT_EQ(std::string(e.what()), std::string("display lost"));
+    }
+    return true;
+}
@@ -0,0 +1,97 @@
+#include "astro/core/io/TGAImage.hpp"
+#include "astro_test.hpp"
+
+#include <filesystem>
+#include <stdexcept>
+#include <vector>
+
+using namespace astro::core::io;
+using namespace astro::graphics;
+
+static std::vector<uint8_t> tgaHeader(int type, int width, int height, int bpp, bool topDown) {
+    std::vector<uint8_t> data(TGAImage::TGA_HEADER_SIZE, 0);
+    data[2] = static_cast<uint8_t>(type);
+    data[12] = width & 0xFF; data[13] = (width >> 8) & 0xFF;
+    data[14] = height & 0xFF; data[15] = (height >> 8) & 0xFF;
+    data[16] = static_cast<uint8_t>(bpp);
+    data[17] = topDown ? 0x20 : 0x00;
+    return data;
+}
+
+TEST(tgaDecodeRaw){
+    // 24-bit bottom-up: the first row of the file is the last row of the texture.
+    // 20 pixels per row so the SIMD kernels and their scalar tails both run
+    const int w = 20, h = 2;
+    std::vector<uint8_t> data = tgaHeader(TGAImage::TGA_TYPE_UNCOMPRESSED_RGB, w, h, 24, false);
+    for (int y = 0; y < h; y++)
+        for (int x = 0; x < w; x++)
+            data.insert(data.end(), {uint8_t(x), uint8_t(y), uint8_t(100 + x)}); // B, G, R
+    Texture image = TGAImage::readImageFromMemory(data.data(), data.size());
+
+    ASSERT_EQ(image.width, w);
+    ASSERT_TRUE(getPixel(image, 0, 1) == Color(100, 0, 0, 255));
+    ASSERT_TRUE(getPixel(image, 19, 1) == Color(119, 0, 19, 255));
+    ASSERT_TRUE(getPixel(image, 7, 0) == Color(107, 1, 7, 255));
+
+    // 32-bit top-down keeps alpha
+    data = tgaHeader(TGAImage::TGA_TYPE_UNCOMPRESSED_RGB, w, h, 32, true);
+    for (int i = 0; i < w * h; i++) data.insert(data.end(), {uint8_t(i), 2, 3, uint8_t(200 - i)});
+    image = TGAImage::readImageFromMemory(data.data(), data.size());
+    ASSERT_TRUE(getPixel(image, 0, 0) == Color(3, 2, 0, 200));
+    ASSERT_TRUE(getPixel(image, 5, 1) == Color(3, 2, 25, 175));
+
+    // Truncated pixel data
+    data.resize(data.size() - 1);
+    try {
+        TGAImage::readImageFromMemory(data.data(), data.size());
+        ASSERT_TRUE(false);
+    } catch (std::runtime_error &e) {
+        ASSERT_TRUE(true);
+    }
+    return true;
+}
+
+TEST(tgaDecodeRLE){
+    // 3x2 top-down, packets crossing the row end: RLE x4, RAW x2
+    std::vector<uint8_t> data = tgaHeader(TGAImage::TGA_TYPE_RLE_RGB, 3, 2, 24, true);
+    data.insert(data.end(), {128 + 3, 10, 20, 30});
+    data.insert(data.end(), {1, 1, 2, 3, 4, 5, 6});
+    Texture image = TGAImage::readImageFromMemory(data.data(), data.size());
+
+    ASSERT_TRUE(getPixel(image, 0, 0) == Color(30, 20, 10, 255));
+    ASSERT_TRUE(getPixel(image, 2, 0) == Color(30, 20, 10, 255));
+    ASSERT_TRUE(getPixel(image, 0, 1) == Color(30, 20, 10, 255));
+    ASSERT_TRUE(getPixel(image, 1, 1) == Color(3, 2, 1, 255));
+    ASSERT_TRUE(getPixel(image, 2, 1) == Color(6, 5, 4, 255));
+
+    // A stream ending early leaves the rest black, a cut packet throws
+    data.resize(data.size() - 7);
+    image = TGAImage::readImageFromMemory(data.data(), data.size());
+    ASSERT_TRUE(getPixel(image, 2, 1) == Color(0, 0, 0, 255));
+    data.push_back(1);
+    data.push_back(7);
+    try {
+        TGAImage::readImageFromMemory(data.data(), data.size());
+        ASSERT_TRUE(false);
+    } catch (std::runtime_error &e) {
+        ASSERT_TRUE(true);
+    }
+    return true;
+}
+
+TEST(tgaWriteRead){
+    Texture image(33, 5);
+    for (int y = 0; y < image.height; y++)
+        for (int x = 0; x < image.width; x++) {
+            Color c(uint8_t(x * 7), uint8_t(y * 40), uint8_t(x + y), uint8_t(255 - x));
+            putPixel(image, x, y, c);
+        }
+    const std::string path = (std::filesystem::temp_directory_path() / "astro_roundtrip.tga").string();
+    TGAImage::writeImage(path, image);
+    const Texture read = TGAImage::readImage(path);
+
+    ASSERT_EQ(read.width, image.width);
+    ASSERT_EQ(read.height, image.height);
+    ASSERT_TRUE(read.data == image.data);
+    return true;
+}
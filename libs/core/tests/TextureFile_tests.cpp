@@ -0,0 +1,86 @@
+#include "astro/core/io/TextureFile.hpp"
+#include "astro/core/io/TGAImage.hpp"
+#include "astro_test.hpp"
+
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+using namespace astro::core::io;
+using namespace astro::graphics;
+
+static std::string tempPath(const std::string& name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+TEST(textureFileMips){
+    // 5x3 checker: odd sizes clamp at the border
+    Texture image(5, 3);
+    for (int y = 0; y < image.height; y++)
+        for (int x = 0; x < image.width; x++) {
+            Color c = ((x + y) % 2) ? Color(200, 100, 0, 255) : Color(0, 0, 40, 255);
+            putPixel(image, x, y, c);
+        }
+    const std::string path = tempPath("astro_mips.astrotex");
+    TextureFile::write(path, image);
+    const TextureFile file(path);
+
+    ASSERT_TRUE(file.isMapped());
+    ASSERT_EQ(file.levels(), 3); // 5x3, 2x1, 1x1
+    ASSERT_EQ(file.width(1), 2);
+    ASSERT_EQ(file.height(1), 1);
+
+    const Texture level0 = file.level(0);
+    ASSERT_TRUE(level0.data.isBorrowed());
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(level0.data.data()) % TextureFile::ALIGNMENT, 0);
+    ASSERT_TRUE(level0.data == image.data);
+
+    const Texture level1 = file.level(1);
+    ASSERT_TRUE(getPixel(level1, 0, 0) == Color(100, 50, 20, 255)); // 2x2 average
+    ASSERT_TRUE(getPixel(level1, 1, 0) == Color(100, 50, 20, 255));
+
+    // Copies own their pixels: drawing on a copy leaves the mapping untouched
+    Texture copy = level0;
+    ASSERT_FALSE(copy.data.isBorrowed());
+    Color red(255, 0, 0, 255);
+    putPixel(copy, 0, 0, red);
+    ASSERT_TRUE(getPixel(file.level(0), 0, 0) == Color(0, 0, 40, 255));
+
+    // Not a texture
+    try {
+        TextureFile invalid(tempPath("astro_mips.astrotex.missing"));
+        ASSERT_TRUE(false);
+    } catch (std::runtime_error &e) {
+        ASSERT_TRUE(true);
+    }
+    return true;
+}
+
+TEST(textureFileTGACache){
+    Texture image(16, 8);
+    for (int i = 0; i < static_cast<int>(image.data.size()); i++) image.data[i] = Color(uint8_t(i), uint8_t(i * 3), 7, 255);
+    const std::string tgaPath = tempPath("astro_cached.tga");
+    TGAImage::writeImage(tgaPath, image);
+    std::filesystem::remove(TextureFile::cachePath(tgaPath));
+
+    // First load decodes and writes the cache, the second one maps it
+    const TextureFile decoded = TextureFile::loadTGA(tgaPath, false);
+    ASSERT_TRUE(std::filesystem::exists(TextureFile::cachePath(tgaPath)));
+    ASSERT_EQ(decoded.levels(), 1);
+    const TextureFile cached = TextureFile::loadTGA(tgaPath, false);
+    ASSERT_TRUE(cached.isMapped());
+    ASSERT_TRUE(cached.level().data == image.data);
+
+    // Asking for mips rebuilds a cache without them
+    const TextureFile mipmapped = TextureFile::loadTGA(tgaPath);
+    ASSERT_EQ(mipmapped.levels(), 5);
+    ASSERT_TRUE(getPixel(mipmapped.level(4), 0, 0)[2] == 7);
+
+    // Edited source: rebuilt
+    Texture other(4, 4);
+    TGAImage::writeImage(tgaPath, other);
+    const TextureFile rebuilt = TextureFile::loadTGA(tgaPath);
+    ASSERT_EQ(rebuilt.width(), 4);
+    ASSERT_TRUE(rebuilt.level().data == other.data);
+    return true;
+}
@@ -0,0 +1,335 @@
+#include "astro/graphics/graphics.hpp"
+#include "astro/math/batch.hpp"
+#include "astro/math/expr.hpp"
+#include "astro/math/math.hpp"
+#include "astro/math/transform.hpp"
+#include "astro_bench.hpp"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace astro::graphics;
+using namespace astro::math;
+
+// Build with -DASTRO_MATH_CHECKED=ON and OFF to compare checked and unchecked math.
+
+// ========================================================
+// --- MATRIX ---------------------------------------------
+// ========================================================
+static Mat4f benchMatrix(float seed) {
+    Mat4f M(0.0f);
+    for (int i = 0; i < 16; i++) M.data[i] = seed + 0.25f * i;
+    return M;
+}
+
+BENCHMARK(Mat4fMultiply) {
+    Mat4f A = benchMatrix(1.0f);
+    const Mat4f B = benchMatrix(0.001f);
+    for (size_t i = 0; i < iterations; i++) {
+        A = A * B;
+        doNotOptimize(A);
+    }
+    return iterations;
+}
+
+BENCHMARK(Mat4fMultiplyGeneric) {
+    // Generic template through operator() (range checked when ASTRO_MATH_CHECKED is on)
+    Mat4f A = benchMatrix(1.0f);
+    Mat4f B = benchMatrix(0.001f);
+    Matrix_View<float, 4, 4> Bv(B);
+    for (size_t i = 0; i < iterations; i++) {
+        Matrix_View<float, 4, 4> Av(A);
+        A = Av * Bv;
+        doNotOptimize(A);
+    }
+    return iterations;
+}
+
+BENCHMARK(Mat4fMultiplyAlwaysChecked) {
+    // Same loop as the generic template, with at()
+    Mat4f A = benchMatrix(1.0f);
+    const Mat4f B = benchMatrix(0.001f);
+    for (size_t n = 0; n < iterations; n++) {
+        Mat4f res(0.0f);
+        for (int i = 0; i < 4; ++i)
+            for (int k = 0; k < 4; ++k)
+                for (int j = 0; j < 4; ++j)
+                    res.at(i, j) += A.at(i, k) * B.at(k, j);
+        A = res;
+        doNotOptimize(A);
+    }
+    return iterations;
+}
+
+BENCHMARK(Mat4fVec4fMultiply) {
+    const Mat4f A = benchMatrix(0.001f);
+    Vec4f v(1.0f, 2.0f, 3.0f, 1.0f);
+    for (size_t i = 0; i < iterations; i++) {
+        v = A * v;
+        doNotOptimize(v);
+    }
+    return iterations;
+}
+
+BENCHMARK(Mat4fInverseGeneral) {
+    Mat4f A = benchMatrix(0.0f);
+    A(3, 0) = 0.0f; A(3, 1) = 0.0f; A(3, 2) = 0.0f; A(3, 3) = 1.0f;
+    A(0, 0) += 3.0f; A(1, 1) += 5.0f; A(2, 2) += 7.0f;
+    for (size_t i = 0; i < iterations; i++) doNotOptimize(inverse(A));
+    return iterations;
+}
+
+BENCHMARK(Mat4fInverseAffine) {
+    Mat4f A = benchMatrix(0.0f);
+    A(3, 0) = 0.0f; A(3, 1) = 0.0f; A(3, 2) = 0.0f; A(3, 3) = 1.0f;
+    A(0, 0) += 3.0f; A(1, 1) += 5.0f; A(2, 2) += 7.0f;
+    for (size_t i = 0; i < iterations; i++) doNotOptimize(inverseAffine(A));
+    return iterations;
+}
+
+BENCHMARK(Mat4fInverseRigid) {
+    const float c = std::cos(0.3f), s = std::sin(0.3f);
+    const Mat4f A({c, -s, 0.0f, 1.0f, s, c, 0.0f, 2.0f, 0.0f, 0.0f, 1.0f, 3.0f, 0.0f, 0.0f, 0.0f, 1.0f});
+    for (size_t i = 0; i < iterations; i++) doNotOptimize(inverseRigid(A));
+    return iterations;
+}
+
+BENCHMARK(UpdateMVPGeneral) {
+    BasicShader shader;
+    shader.viewMatrix(2, 3) = -5.0f;
+    for (size_t i = 0; i < iterations; i++) {
+        shader.modelMatrix(0, 3) = static_cast<float>(i & 7);
+        shader.updateMVP();
+        doNotOptimize(shader);
+    }
+    return iterations;
+}
+
+BENCHMARK(UpdateMVPRigid) {
+    BasicShader shader;
+    shader.viewMatrix(2, 3) = -5.0f;
+    shader.modelTransform = TransformType::Rigid;
+    shader.viewTransform = TransformType::Rigid;
+    for (size_t i = 0; i < iterations; i++) {
+        shader.modelMatrix(0, 3) = static_cast<float>(i & 7);
+        shader.updateMVP();
+        doNotOptimize(shader);
+    }
+    return iterations;
+}
+
+static Transform benchTransform(float seed) {
+    return Transform(Vec3f(seed, 2.0f, -seed), Quatf::fromAxisAngle(normalize(Vec3f(1.0f, seed, 0.5f)), seed), Vec3f(1.5f));
+}
+
+BENCHMARK(TransformCompose) {
+    Transform A = benchTransform(0.3f);
+    const Transform B = benchTransform(0.01f);
+    for (size_t i = 0; i < iterations; i++) {
+        A = A * B;
+        doNotOptimize(A);
+    }
+    return iterations;
+}
+
+BENCHMARK(TransformInverse) {
+    const Transform A = benchTransform(0.3f);
+    for (size_t i = 0; i < iterations; i++) doNotOptimize(inverse(A));
+    return iterations;
+}
+
+BENCHMARK(TransformToMat4f) {
+    const Transform A = benchTransform(0.3f);
+    for (size_t i = 0; i < iterations; i++) doNotOptimize(A.toMat4f());
+    return iterations;
+}
+
+
+// ========================================================
+// --- LINEAR SYSTEMS -------------------------------------
+// ========================================================
+// 8 diagonally dominant 4x4 systems (per vertex quadric solves), time per system
+static Mat4f benchSystem(int i) {
+    Mat4f M = benchMatrix(0.1f * i);
+    for (int d = 0; d < 4; d++) M(d, d) += 20.0f;
+    return M;
+}
+
+BENCHMARK(Solve4x4LU) {
+    std::vector<Mat4f> A;
+    for (int i = 0; i < 8; i++) A.push_back(benchSystem(i));
+    const Vec4f b(1.0f, 2.0f, 3.0f, 4.0f);
+    for (size_t i = 0; i < iterations; i += 8) {
+        for (int s = 0; s < 8; s++) doNotOptimize(solve(A[s], b));
+    }
+    return iterations;
+}
+
+BENCHMARK(Solve4x4Batch) {
+    Mat4fx8 A(0.0f);
+    for (int i = 0; i < 8; i++) A.setLane(i, benchSystem(i));
+    const Vec4fx8 b(Vec4f(1.0f, 2.0f, 3.0f, 4.0f));
+    Vec4fx8 x;
+    for (size_t i = 0; i < iterations; i += 8) {
+        doNotOptimize(solve(A, b, x));
+        doNotOptimize(x);
+    }
+    return iterations;
+}
+
+BENCHMARK(Determinant6x6) {
+    Matrix<float, 6, 6> A(0.0f);
+    for (int i = 0; i < 36; i++) A.data[i] = std::sin(float(i));
+    for (size_t i = 0; i < iterations; i++) {
+        doNotOptimize(A);
+        doNotOptimize(determinant(A));
+    }
+    return iterations;
+}
+
+// ========================================================
+// --- SHADING --------------------------------------------
+// ========================================================
+static PhongShader benchShader() {
+    PhongShader shader;
+    shader.material = std::make_shared<Material>();
+    shader.material->shininess = 32.0f;
+    shader.material->diffuseCoeff = 0.8f;
+    shader.material->specularCoeff = 0.5f;
+    shader.material->color = Vec4f(0.8f, 0.6f, 0.4f, 1.0f);
+    shader.cameraPos = Vec3f(0.0f, 0.0f, 3.0f);
+
+    Light sun;
+    sun.type = Light::DIRECTIONAL;
+    sun.color = Vec4f(1.0f, 1.0f, 0.9f, 1.0f);
+    sun.worldDir = Vec3f(-0.3f, -1.0f, -0.5f);
+    sun.intensity = 1.0f;
+    Light lamp;
+    lamp.type = Light::POINT;
+    lamp.color = Vec4f(0.4f, 0.4f, 1.0f, 1.0f);
+    lamp.worldPos = Vec3f(1.0f, 1.0f, 1.0f);
+    lamp.intensity = 4.0f;
+    lamp.range = 10.0f;
+    shader.sceneLights = {sun, lamp};
+    return shader;
+}
+
+static std::vector<Varyings> benchFragments(size_t count) {
+    std::vector<Varyings> fragments(count);
+    for (size_t i = 0; i < count; i++) {
+        float t = static_cast<float>(i) / static_cast<float>(count);
+        fragments[i].uv = Vec2f(t, 1.0f - t);
+        fragments[i].pos = Vec4f(t, t, 0.5f, 1.0f);
+        fragments[i].worldPos = Vec4f(t - 0.5f, 0.5f - t, 0.0f, 1.0f);
+        fragments[i].normal = Vec3f(0.2f * t, 0.3f, 1.0f);
+        fragments[i].tangent = Vec3f(1.0f, 0.0f, 0.0f);
+    }
+    return fragments;
+}
+
+BENCHMARK(PhongShaderFragment) {
+    static const PhongShader shader = benchShader();
+    static const std::vector<Varyings> fragments = benchFragments(1024);
+    Color color;
+    for (size_t i = 0; i < iterations; i++) {
+        shader.fragment(fragments[i % fragments.size()], color);
+        doNotOptimize(color);
+    }
+    return iterations;
+}
+
+BENCHMARK(PhongShaderFragmentFast) {
+    static const PhongShader shader = [] {
+        PhongShader fastShader = benchShader();
+        fastShader.material->quality = ShadingQuality::Fast;
+        return fastShader;
+    }();
+    static const std::vector<Varyings> fragments = benchFragments(1024);
+    Color color;
+    for (size_t i = 0; i < iterations; i++) {
+        shader.fragment(fragments[i % fragments.size()], color);
+        doNotOptimize(color);
+    }
+    return iterations;
+}
+
+
+// ========================================================
+// --- RASTERIZATION --------------------------------------
+// ========================================================
+struct BenchInterpolants {
+    Vec2f uv[3];
+    Vec3f normal[3];
+    Vec3f worldPos[3];
+};
+
+static BenchInterpolants benchInterpolants() {
+    BenchInterpolants in;
+    for (int i = 0; i < 3; i++) {
+        in.uv[i] = Vec2f(0.1f * i, 0.2f * i);
+        in.normal[i] = Vec3f(0.3f * i, 1.0f, 0.1f);
+        in.worldPos[i] = Vec3f(1.0f * i, 2.0f, 3.0f - i);
+    }
+    return in;
+}
+
+// Per pixel attribute interpolation of the raster loop, with temporaries
+BENCHMARK(InterpolateEager) {
+    const BenchInterpolants in = benchInterpolants();
+    for (size_t i = 0; i < iterations; i++) {
+        const float alpha = static_cast<float>(i & 255) * (1.0f / 512.0f);
+        const float beta = 0.25f, gamma = 1.0f - alpha - beta, w = 1.5f;
+        Vec2f uv = (in.uv[0] * alpha + in.uv[1] * beta + in.uv[2] * gamma) * w;
+        Vec3f normal = (in.normal[0] * alpha + in.normal[1] * beta + in.normal[2] * gamma) * w;
+        Vec3f worldPos = (in.worldPos[0] * alpha + in.worldPos[1] * beta + in.worldPos[2] * gamma) * w;
+        doNotOptimize(uv);
+        doNotOptimize(normal);
+        doNotOptimize(worldPos);
+    }
+    return iterations;
+}
+
+// Same interpolation through expression templates (one fused loop per attribute)
+BENCHMARK(InterpolateFused) {
+    using expr::lazy;
+    const BenchInterpolants in = benchInterpolants();
+    for (size_t i = 0; i < iterations; i++) {
+        const float alpha = static_cast<float>(i & 255) * (1.0f / 512.0f);
+        const float beta = 0.25f, gamma = 1.0f - alpha - beta, w = 1.5f;
+        Vec2f uv = (lazy(in.uv[0]) * alpha + lazy(in.uv[1]) * beta + lazy(in.uv[2]) * gamma) * w;
+        Vec3f normal = (lazy(in.normal[0]) * alpha + lazy(in.normal[1]) * beta + lazy(in.normal[2]) * gamma) * w;
+        Vec3f worldPos = (lazy(in.worldPos[0]) * alpha + lazy(in.worldPos[1]) * beta + lazy(in.worldPos[2]) * gamma) * w;
+        doNotOptimize(uv);
+        doNotOptimize(normal);
+        doNotOptimize(worldPos);
+    }
+    return iterations;
+}
+
+// Full raster loop of a 256x256 screen-covering triangle (ns per triangle)
+BENCHMARK(RasterTriangle) {
+    static Texture canvas(256, 256);
+    static ZBuffer zbuffer(256, 256);
+    const BasicShader shader;
+    Triangle triangle;
+    triangle[0].pos = Vec4f(-1.0f, -1.0f, 0.5f, 1.0f);
+    triangle[1].pos = Vec4f(1.0f, -1.0f, 0.5f, 1.0f);
+    triangle[2].pos = Vec4f(-1.0f, 1.0f, 0.5f, 1.0f);
+    for (int i = 0; i < 3; i++) {
+        triangle[i].uv = Vec2f(0.5f * i, 1.0f - 0.5f * i);
+        triangle[i].normal = Vec3f(0.0f, 0.0f, 1.0f);
+        triangle[i].tangent = Vec3f(1.0f, 0.0f, 0.0f);
+    }
+    for (size_t i = 0; i < iterations; i++) {
+        clearZBuffer(zbuffer);
+        TDRenderer::renderTriangle(canvas, zbuffer, triangle, shader);
+        doNotOptimize(canvas.data[0]);
+    }
+    return iterations;
+}
+
+int main(){
+    run_all_benchmarks();
+    return 0;
+}
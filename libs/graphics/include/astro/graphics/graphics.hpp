@@ -1,7 +1,9 @@
 #pragma once
 
 #include "astro/math/math.hpp"
+#include "astro/math/transform.hpp"
 #include <X11/Xlib.h>
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <sys/types.h>
@@ -30,17 +32,115 @@ struct Color : public Vector<uint8_t, 4> {
 
 
 
+// --- Damage tracking ------------------------------
+struct Rect {
+    int x, y;
+    int width, height;
+};
+
+// --- Pixel storage --------------------------------
+/**
+ * @brief Contiguous pixels, either owned (like a std::vector) or borrowed from external memory
+ * (e.g. a memory-mapped file) kept alive by 'owner'. Copies always own their pixels, so a
+ * copy never writes into the borrowed memory.
+ */
+template<typename T>
+class PixelBuffer {
+public:
+    PixelBuffer() = default;
+    PixelBuffer(size_t count, const T& value) : owned(count, value), pixels(owned.data()), count(count) {}
+    PixelBuffer(T* external, size_t count, std::shared_ptr<void> owner)
+        : owner(std::move(owner)), pixels(external), count(count) {}
+
+    PixelBuffer(const PixelBuffer& other) : owned(other.begin(), other.end()), pixels(owned.data()), count(other.count) {}
+    PixelBuffer(PixelBuffer&& other) noexcept { *this = std::move(other); }
+    PixelBuffer& operator=(const PixelBuffer& other) {
+        if (this != &other) *this = PixelBuffer(other);
+        return *this;
+    }
+    PixelBuffer& operator=(PixelBuffer&& other) noexcept {
+        owned = std::move(other.owned); // Moving a vector keeps its storage
+        owner = std::move(other.owner);
+        pixels = other.pixels;
+        count = other.count;
+        other.pixels = nullptr;
+        other.count = 0;
+        return *this;
+    }
+
+    T* data() { return pixels; }
+    const T* data() const { return pixels; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    bool isBorrowed() const { return owner != nullptr; }
+
+    T& operator[](size_t i) { return pixels[i]; }
+    const T& operator[](size_t i) const { return pixels[i]; }
+    T* begin() { return pixels; }
+    T* end() { return pixels + count; }
+    const T* begin() const { return pixels; }
+    const T* end() const { return pixels + count; }
+
+    bool operator==(const PixelBuffer& other) const { return std::equal(begin(), end(), other.begin(), other.end()); }
+
+private:
+    std::vector<T> owned;
+    std::shared_ptr<void> owner;
+    T* pixels = nullptr;
+    size_t count = 0;
+};
+
 // --- Texture --------------------------------------
 struct Texture {
+    static constexpr int MAX_DAMAGE_RECTS = 16; // More rects are merged into their bounding box
+
     int width;
     int height;
-    std::vector<Color> data;
-    Texture(int width, int height): width(width), height(height){
-        data.resize(width*height, Color(0,0,0,255));
+    PixelBuffer<Color> data;
+    std::vector<Rect> damage; // Regions written since the damage was last cleared
+    Texture(int width, int height): width(width), height(height), data(static_cast<size_t>(width) * height, Color(0,0,0,255)){
+        damage.push_back({0, 0, width, height});
+    }
+    /**
+     * @brief Texture over external pixels (no copy), kept alive by 'owner'
+     */
+    Texture(int width, int height, Color* pixels, std::shared_ptr<void> owner)
+        : width(width), height(height), data(pixels, static_cast<size_t>(width) * height, std::move(owner)) {
+        damage.push_back({0, 0, width, height});
     }
     int index(int x, int y) const { return y*width+x; }
 };
 
+/**
+ * @brief Marks a region of the texture as modified. 
+ * Drawing functions do it automatically, direct pixel writes (putPixel, data) must do it by hand.
+ * @param texture 
+ * @param x 
+ * @param y 
+ * @param width 
+ * @param height 
+ */
+void markDamaged(Texture& texture, int x, int y, int width, int height);
+
+/**
+ * @brief Marks the whole texture as modified
+ * @param texture 
+ */
+void markAllDamaged(Texture& texture);
+
+/**
+ * @brief Forgets every damaged region of the texture
+ * @param texture 
+ */
+void clearDamage(Texture& texture);
+
+/**
+ * @brief Number of pixels covered by the damaged regions (overlaps are counted twice)
+ * @param texture 
+ * @return long 
+ */
+long damagedArea(const Texture& texture);
+
 /**
  * @brief Clears the texture with color 'color'
  * @param texture 
@@ -232,6 +332,24 @@ struct Varyings {
     Vec3f tangent;
 };
 
+/**
+ * @brief Vertex stage outputs of a whole vertex array in SoA layout (one array per component),
+ * so the vertex stage can write blocks of vertices with SIMD stores.
+ */
+struct VaryingsBatch {
+    std::vector<float> posX, posY, posZ, posW;          // Clip space position
+    std::vector<float> worldPosX, worldPosY, worldPosZ;
+    std::vector<float> normalX, normalY, normalZ;
+    std::vector<float> tangentX, tangentY, tangentZ;
+    std::vector<float> u, v;
+    std::vector<uint8_t> valid;                         // Result of the vertex shader
+
+    size_t size() const { return valid.size(); }
+    void resize(size_t count);
+    Varyings get(size_t i) const;
+    void set(size_t i, const Varyings& varying, bool isValid);
+};
+
 // Lighting
 struct Light {
     enum{ DIRECTIONAL, POINT } type;
@@ -243,12 +361,20 @@ struct Light {
 };
 
 // Materials
+/**
+ * @brief Math used when shading a material.
+ * Fast replaces std::pow, sqrt and divisions with astro::math::fast approximations
+ * (relative errors below 3e-5, not visible in 8 bit color).
+ */
+enum class ShadingQuality { Exact, Fast };
+
 struct Material {
     float shininess;        // Higher -> sharper lighting
     float diffuseCoeff;
     float specularCoeff;
     float oppacity = 1.0f;
     Vec4f color;            // Material base color
+    ShadingQuality quality = ShadingQuality::Exact;
 
     // Textures
     std::shared_ptr<Texture> colorTexture   = nullptr;
@@ -267,6 +393,14 @@ struct IShader {
      */
     virtual bool vertex(const VertexAttributes& in_vert, Varyings& out_varying) const = 0;
 
+    /**
+     * @brief Vertex shader for a whole vertex array. The default runs vertex() on every vertex
+     * @param in_verts 
+     * @param count 
+     * @param out_varyings resized to 'count'
+     */
+    virtual void vertexBatch(const VertexAttributes* in_verts, size_t count, VaryingsBatch& out_varyings) const;
+
     /**
      * @brief Vertex shader (process a fragment)
      * @param frag clip-space position: 2d aliasing + depth
@@ -283,8 +417,27 @@ struct BasicShader : public IShader {
     Mat4f viewMatrix = Mat4f::Identity();
     Mat4f projectionMatrix = Mat4f::Identity();
 
+    // Declared structure of the model/view matrices. Affine or rigid transforms
+    // let updateMVP() skip the general inverse (e.g. lookAt() view matrices are rigid)
+    TransformType modelTransform = TransformType::General;
+    TransformType viewTransform = TransformType::General;
+
+    /**
+     * @brief Sets the model matrix and its declared type from a TRS transform
+     * (the transform builds its matrix here, only when a shader needs it)
+     */
+    void setModel(const Transform& model) {
+        modelMatrix = model.matrix();
+        modelTransform = model.type();
+    }
+
     void updateMVP();
     virtual bool vertex(const VertexAttributes& in_vert, Varyings& out_varying) const override;
+    /**
+     * @brief SIMD vertex shader, 8 vertices per step. Blocks run in parallel on large meshes
+     * when the library is built with ASTRO_GRAPICS_PARALLEL
+     */
+    virtual void vertexBatch(const VertexAttributes* in_verts, size_t count, VaryingsBatch& out_varyings) const override;
     virtual bool fragment(const Varyings& interpolated, Color& out_color) const override;
 
 protected:
@@ -317,6 +470,17 @@ struct PhongShader : public BasicShader {
  */
 struct TDRenderer {
     static void renderTriangle(Texture& texture, ZBuffer& zbuffer, const Triangle& triangle, const IShader& shader);
+
+    /**
+     * @brief Renders an indexed triangle list. Every vertex goes through the vertex stage
+     * once (IShader::vertexBatch), then the triangles are rasterized.
+     * @param texture 
+     * @param zbuffer 
+     * @param vertices 
+     * @param indices three per triangle
+     * @param shader 
+     */
+    static void renderMesh(Texture& texture, ZBuffer& zbuffer, const std::vector<VertexAttributes>& vertices, const std::vector<uint32_t>& indices, const IShader& shader);
 };
 
 }
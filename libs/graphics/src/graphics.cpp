@@ -1,11 +1,16 @@
 
 #include "astro/graphics/graphics.hpp"
+#include "astro/math/batch.hpp"
+#include "astro/math/fast.hpp"
 #include "astro/math/math.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
+#include <initializer_list>
+#include <stdexcept>
 #include <utility>
 
 using namespace astro::math;
@@ -13,9 +18,55 @@ using namespace astro::math;
 namespace astro {
 namespace graphics {
 
+// --- Damage tracking ------------------------------
+void markDamaged(Texture& texture, int x, int y, int width, int height) {
+    // Clip to the texture
+    int x0 = std::max(0, x);
+    int y0 = std::max(0, y);
+    int x1 = std::min(texture.width, x + width);
+    int y1 = std::min(texture.height, y + height);
+    if (x0 >= x1 || y0 >= y1) return;
+    Rect rect = {x0, y0, x1 - x0, y1 - y0};
+
+    // Skip already covered regions and drop the ones covered by the new rect
+    std::vector<Rect>& damage = texture.damage;
+    for (const Rect& r : damage) {
+        if (r.x <= rect.x && r.y <= rect.y && r.x + r.width >= x1 && r.y + r.height >= y1) return;
+    }
+    std::erase_if(damage, [&](const Rect& r) {
+        return rect.x <= r.x && rect.y <= r.y && x1 >= r.x + r.width && y1 >= r.y + r.height;
+    });
+
+    if (static_cast<int>(damage.size()) < Texture::MAX_DAMAGE_RECTS) {
+        damage.push_back(rect);
+        return;
+    }
+
+    // Too many regions: collapse everything into the bounding box
+    for (const Rect& r : damage) {
+        x0 = std::min(x0, r.x);
+        y0 = std::min(y0, r.y);
+        x1 = std::max(x1, r.x + r.width);
+        y1 = std::max(y1, r.y + r.height);
+    }
+    damage.assign(1, Rect{x0, y0, x1 - x0, y1 - y0});
+}
+void markAllDamaged(Texture& texture) {
+    texture.damage.assign(1, Rect{0, 0, texture.width, texture.height});
+}
+void clearDamage(Texture& texture) {
+    texture.damage.clear();
+}
+long damagedArea(const Texture& texture) {
+    long area = 0;
+    for (const Rect& r : texture.damage) area += static_cast<long>(r.width) * r.height;
+    return area;
+}
+
 // --- Texture --------------------------------------
 void clearTexture(Texture& texture, Color &color){
     std::fill(texture.data.begin(), texture.data.end(), color);
+    markAllDamaged(texture);
 }
 bool isInTextureBounds(Texture &texture, int x, int y){
     return x >= 0 && x < texture.width && y >= 0 && y < texture.height;
@@ -118,6 +169,8 @@ void draw2dLine(Texture& texture, int x1, int y1, int x2, int y2, Color &color){
     }
     
     if (vx == 0) return;
+    if (transpose) markDamaged(texture, std::min(y1, y2), x1, std::abs(y2 - y1) + 1, x2 - x1 + 1);
+    else           markDamaged(texture, x1, std::min(y1, y2), x2 - x1 + 1, std::abs(y2 - y1) + 1);
     for (int x = x1; x <= x2; x++){
         const float t = (x - x1) / (vx);
         const int y = std::round(y1 + vy * t);
@@ -147,6 +200,7 @@ void draw2dTriangle(Texture &texture, int x1, int y1, int x2, int y2, int x3, in
     int bbmaxy = std::min(texture.height - 1, (int)std::ceil(std::max({y1, y2, y3})));
 
     double total_area = signed_triangle_area(x1, y1, x2, y2, x3, y3);
+    markDamaged(texture, bbminx, bbminy, bbmaxx - bbminx + 1, bbmaxy - bbminy + 1);
 
     #pragma omp parallel for
     for (int x=bbminx; x<=bbmaxx; x++) {
@@ -168,11 +222,60 @@ void draw2dTriangle(Texture& texture, Vec2i a, Vec2i b, Vec2i c, Color color) {
 
 
 // --- 3D Rendering ---------------------------------
+// Varyings Batch
+void VaryingsBatch::resize(size_t count) {
+    for (std::vector<float>* component : {&posX, &posY, &posZ, &posW, &worldPosX, &worldPosY, &worldPosZ,
+                                          &normalX, &normalY, &normalZ, &tangentX, &tangentY, &tangentZ, &u, &v})
+        component->resize(count);
+    valid.resize(count);
+}
+Varyings VaryingsBatch::get(size_t i) const {
+    Varyings res;
+    res.uv = Vec2f(u[i], v[i]);
+    res.pos = Vec4f(posX[i], posY[i], posZ[i], posW[i]);
+    res.worldPos = Vec4f(worldPosX[i], worldPosY[i], worldPosZ[i], 1.0f);
+    res.normal = Vec3f(normalX[i], normalY[i], normalZ[i]);
+    res.tangent = Vec3f(tangentX[i], tangentY[i], tangentZ[i]);
+    return res;
+}
+void VaryingsBatch::set(size_t i, const Varyings& varying, bool isValid) {
+    u[i] = varying.uv.x; v[i] = varying.uv.y;
+    posX[i] = varying.pos.x; posY[i] = varying.pos.y; posZ[i] = varying.pos.z; posW[i] = varying.pos.w;
+    worldPosX[i] = varying.worldPos.x; worldPosY[i] = varying.worldPos.y; worldPosZ[i] = varying.worldPos.z;
+    normalX[i] = varying.normal.x; normalY[i] = varying.normal.y; normalZ[i] = varying.normal.z;
+    tangentX[i] = varying.tangent.x; tangentY[i] = varying.tangent.y; tangentZ[i] = varying.tangent.z;
+    valid[i] = isValid;
+}
+
+// Shader
+void IShader::vertexBatch(const VertexAttributes* in_verts, size_t count, VaryingsBatch& out_varyings) const {
+    out_varyings.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        Varyings varying{};
+        bool isValid = vertex(in_verts[i], varying);
+        out_varyings.set(i, varying, isValid);
+    }
+}
+
 // Basic Shader
 void BasicShader::updateMVP() {
     MV = viewMatrix * modelMatrix;
     MVP = projectionMatrix * MV;
-    MV_invT = transpose(inverse(MV));
+
+    // MV keeps the least restrictive structure of both matrices
+    const TransformType mvTransform = std::min(modelTransform, viewTransform);
+    if (mvTransform == TransformType::General) {
+        MV_invT = transpose(inverse(MV));
+        return;
+    }
+
+    // Directions only use the upper 3x3 block: the normal matrix (R itself when rigid)
+    const Mat3f normalMatrix = (mvTransform == TransformType::Rigid) 
+        ? Mat3f({MV(0,0), MV(0,1), MV(0,2), MV(1,0), MV(1,1), MV(1,2), MV(2,0), MV(2,1), MV(2,2)}) 
+        : inverseTranspose3x3(MV);
+    MV_invT = Mat4f::Identity();
+    for (int r = 0; r < 3; ++r)
+        for (int c = 0; c < 3; ++c) MV_invT(r, c) = normalMatrix(r, c);
 }
 bool BasicShader::vertex(const VertexAttributes& in_vert, Varyings& out_varying) const {
     out_varying.pos = MVP * in_vert.pos;
@@ -182,6 +285,66 @@ bool BasicShader::vertex(const VertexAttributes& in_vert, Varyings& out_varying)
     out_varying.uv = in_vert.uv;
     return true;
 }
+void BasicShader::vertexBatch(const VertexAttributes* in_verts, size_t count, VaryingsBatch& out_varyings) const {
+    constexpr int W = Vec4fx8::lanes;
+    [[maybe_unused]] constexpr long PARALLEL_MIN_BLOCKS = 1024; // Smaller meshes are not worth waking up the threads
+    out_varyings.resize(count);
+    const long blocks = static_cast<long>(count / W);
+
+    #pragma omp parallel for schedule(static) if(blocks >= PARALLEL_MIN_BLOCKS)
+    for (long b = 0; b < blocks; ++b) {
+        const size_t base = static_cast<size_t>(b) * W;
+
+        // AoS -> SoA (positions with 4x4 register transposes)
+        alignas(32) float posSoA[4][W];
+        for (int i = 0; i < W; i += 4) {
+            simd::f32x4 p0 = in_verts[base + i + 0].pos.reg, p1 = in_verts[base + i + 1].pos.reg;
+            simd::f32x4 p2 = in_verts[base + i + 2].pos.reg, p3 = in_verts[base + i + 3].pos.reg;
+            simd::transpose(p0, p1, p2, p3);
+            simd::store(&posSoA[0][i], p0);
+            simd::store(&posSoA[1][i], p1);
+            simd::store(&posSoA[2][i], p2);
+            simd::store(&posSoA[3][i], p3);
+        }
+        const Vec4fx8 pos(Floatx8::load(posSoA[0]), Floatx8::load(posSoA[1]), Floatx8::load(posSoA[2]), Floatx8::load(posSoA[3]));
+        Vec3fx8 normal, tangent;
+        for (int i = 0; i < W; ++i) {
+            const VertexAttributes& vert = in_verts[base + i];
+            normal.setLane(i, vert.normal);
+            tangent.setLane(i, vert.tangent);
+            out_varyings.u[base + i] = vert.uv.x;
+            out_varyings.v[base + i] = vert.uv.y;
+        }
+
+        // Same transforms as vertex(), 8 vertices at a time
+        const Vec4fx8 clip = MVP * pos;
+        const Vec4fx8 view = MV * pos;
+        const Vec3fx8 n = transformDir(MV_invT, normal);
+        const Vec3fx8 t = transformDir(MV_invT, tangent);
+
+        clip.x().store(&out_varyings.posX[base]);
+        clip.y().store(&out_varyings.posY[base]);
+        clip.z().store(&out_varyings.posZ[base]);
+        clip.w().store(&out_varyings.posW[base]);
+        view.x().store(&out_varyings.worldPosX[base]);
+        view.y().store(&out_varyings.worldPosY[base]);
+        view.z().store(&out_varyings.worldPosZ[base]);
+        n.x().store(&out_varyings.normalX[base]);
+        n.y().store(&out_varyings.normalY[base]);
+        n.z().store(&out_varyings.normalZ[base]);
+        t.x().store(&out_varyings.tangentX[base]);
+        t.y().store(&out_varyings.tangentY[base]);
+        t.z().store(&out_varyings.tangentZ[base]);
+        std::fill_n(out_varyings.valid.begin() + base, W, 1);
+    }
+
+    // Tail
+    for (size_t i = static_cast<size_t>(blocks) * W; i < count; ++i) {
+        Varyings varying{};
+        bool isValid = vertex(in_verts[i], varying);
+        out_varyings.set(i, varying, isValid);
+    }
+}
 bool BasicShader::fragment(const Varyings& interpolated, Color& out_color) const {
     out_color = Color(255, 255, 255, 255);
     return true;
@@ -223,19 +386,36 @@ Vec4f PhongShader::calculatePhong(const Light& light, const Vec3f& normal, const
     }
     return (diffusePart + specularPart) * attenuation;
 }
-bool PhongShader::fragment(const Varyings& interpolated, Color& out_color) const {
+/**
+ * @brief Math used by the Phong shader for each ShadingQuality
+ */
+struct ExactShadingMath {
+    static Vec3f normalize(const Vec3f& v) { return math::normalize(v); }
+    static Vec3f normalizeSq(const Vec3f& v, float lenSq) { return v / std::sqrt(lenSq); }
+    static float pow(float x, float y) { return std::pow(x, y); }
+};
+struct FastShadingMath {
+    static Vec3f normalize(const Vec3f& v) { return fast::normalize(v); }
+    static Vec3f normalizeSq(const Vec3f& v, float lenSq) { return v * fast::rsqrt(lenSq); }
+    static float pow(float x, float y) { return fast::pow(x, y); }
+};
+
+template<typename M>
+static bool phongFragment(const PhongShader& shader, const Varyings& interpolated, Color& out_color) {
+    const Material* material = shader.material.get();
+    const Vec3f& cameraPos = shader.cameraPos;
     Vec3f worldPos = interpolated.worldPos.xyz;
-    Vec3f V = normalize(cameraPos - worldPos);
+    Vec3f V = M::normalize(cameraPos - worldPos);
     
     // Normal Mapping
-    Vec3f finalNormal = normalize(interpolated.normal); 
+    Vec3f finalNormal = M::normalize(interpolated.normal); 
     if (material->normalMap) {
-        Vec3f T = normalize(interpolated.tangent);
+        Vec3f T = M::normalize(interpolated.tangent);
         // Gram-Schmidt is usually done at load time now, but T = normalize(T - N * dot(T, N)) 
         // if you need it here.
         Vec3f B = cross(finalNormal, T);
         Vec3f mappedNormal = sampleTexureVectorAsVec3f(*material->normalMap, interpolated.uv);
-        finalNormal = normalize(T * mappedNormal.x + B * mappedNormal.y + finalNormal * mappedNormal.z);
+        finalNormal = M::normalize(T * mappedNormal.x + B * mappedNormal.y + finalNormal * mappedNormal.z);
     }
 
     // Texture samplers (avoid Vec4f at sampling if alpha is not needed)
@@ -245,7 +425,7 @@ bool PhongShader::fragment(const Varyings& interpolated, Color& out_color) const
 
     // Compute accumulated light
     Vec3f accumulatedLight(0.0f);
-    for(const Light& light : sceneLights) {
+    for(const Light& light : shader.sceneLights) {
         Vec3f L;
         float attenuation = light.intensity;
 
@@ -253,11 +433,10 @@ bool PhongShader::fragment(const Varyings& interpolated, Color& out_color) const
             L = light.worldPos - worldPos;
             float distSq = dot(L, L); // Use squared length to avoid sqrt if possible
             if (distSq > (light.range * light.range)) continue;
-            float dist = std::sqrt(distSq);
             attenuation /= (1.0f + distSq); 
-            L = L / dist; // faster than normalize(L)
+            L = M::normalizeSq(L, distSq); // Reuses the squared length
         } else {
-            L = normalize(light.worldDir * -1.0f);
+            L = M::normalize(light.worldDir * -1.0f);
         }
 
         // Diffuse
@@ -267,11 +446,11 @@ bool PhongShader::fragment(const Varyings& interpolated, Color& out_color) const
         accumulatedLight = accumulatedLight + light.color.xyz * (nDotL * material->diffuseCoeff * attenuation);
 
         // Specular (Blinn-Phong)
-        Vec3f H = normalize(L + V); // Halfway vector
+        Vec3f H = M::normalize(L + V); // Halfway vector
         float nDotH = std::max(0.0f, dot(finalNormal, H));
         
-        // Fast Power approximation (or use a smaller lookup table)
-        float spec = std::pow(nDotH, material->shininess); 
+        // std::pow or the fast approximation, depending on the material quality
+        float spec = M::pow(nDotH, material->shininess);
         accumulatedLight = accumulatedLight + light.color.xyz * (spec * material->specularCoeff * specMask * attenuation);
     }
     
@@ -287,6 +466,11 @@ bool PhongShader::fragment(const Varyings& interpolated, Color& out_color) const
     return true;
 }
 
+bool PhongShader::fragment(const Varyings& interpolated, Color& out_color) const {
+    if (material->quality == ShadingQuality::Fast) return phongFragment<FastShadingMath>(*this, interpolated, out_color);
+    return phongFragment<ExactShadingMath>(*this, interpolated, out_color);
+}
+
 // Renderer
 /**
  * @brief Inverse multiplied components for fast computation
@@ -298,17 +482,17 @@ struct PreppedVarying {
     Vec3f worldPosw;
 };
 
-void TDRenderer::renderTriangle(Texture& texture, ZBuffer& zbuffer, const Triangle& triangle, const IShader& shader) {
-    std::array<Varyings, 3> varyings{};
+/**
+ * @brief Rasterizes a triangle whose vertices already went through the vertex stage
+ */
+static void rasterizeTriangle(Texture& texture, ZBuffer& zbuffer, const std::array<Varyings, 3>& varyings, const IShader& shader) {
     std::array<Vec3f, 3> screen_pts{};
     std::array<float, 3> inv_w{};
 
-    // Vertex Shader
+    // Clip-space -> Screen-space
     for (int i = 0; i < 3; ++i) {
-        if (!shader.vertex(triangle[i], varyings[i])) return;
         if (varyings[i].pos.w < 0.1f) return;
 
-
         inv_w[i] = 1.0f / varyings[i].pos.w;
         screen_pts[i] = {
             (varyings[i].pos.x * inv_w[i] + 1.0f) * 0.5f * (float)texture.width,
@@ -338,6 +522,7 @@ void TDRenderer::renderTriangle(Texture& texture, ZBuffer& zbuffer, const Triang
     int bbmaxx = std::min(texture.width - 1, (int)std::ceil(std::max({screen_pts[0].x, screen_pts[1].x, screen_pts[2].x})));
     int bbmaxy = std::min(texture.height - 1, (int)std::ceil(std::max({screen_pts[0].y, screen_pts[1].y, screen_pts[2].y})));
     float inv_total_area = 1.0f / (float)total_area;
+    markDamaged(texture, bbminx, bbminy, bbmaxx - bbminx + 1, bbmaxy - bbminy + 1);
 
     // Rasterization loop
     for (int y = bbminy; y <= bbmaxy; ++y) {
@@ -373,5 +558,33 @@ void TDRenderer::renderTriangle(Texture& texture, ZBuffer& zbuffer, const Triang
 
 }
 
+void TDRenderer::renderTriangle(Texture& texture, ZBuffer& zbuffer, const Triangle& triangle, const IShader& shader) {
+    std::array<Varyings, 3> varyings{};
+
+    // Vertex Shader
+    for (int i = 0; i < 3; ++i) {
+        if (!shader.vertex(triangle[i], varyings[i])) return;
+    }
+    rasterizeTriangle(texture, zbuffer, varyings, shader);
+}
+
+void TDRenderer::renderMesh(Texture& texture, ZBuffer& zbuffer, const std::vector<VertexAttributes>& vertices, const std::vector<uint32_t>& indices, const IShader& shader) {
+    // Vertex Shader (reuses the buffers between calls)
+    thread_local VaryingsBatch shaded;
+    shader.vertexBatch(vertices.data(), vertices.size(), shaded);
+
+    std::array<Varyings, 3> varyings;
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        bool isValid = true;
+        for (int k = 0; k < 3 && isValid; ++k) {
+            const uint32_t idx = indices[i + k];
+            if (idx >= vertices.size()) throw std::out_of_range("[TDRenderer] ERROR: Vertex index out of bounds");
+            isValid = shaded.valid[idx];
+            varyings[k] = shaded.get(idx);
+        }
+        if (isValid) rasterizeTriangle(texture, zbuffer, varyings, shader);
+    }
+}
+
+}
 }
-}
\ No newline at end of file
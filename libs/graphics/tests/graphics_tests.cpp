@@ -1,12 +1,12 @@
 
 #include <chrono>
 #include <cmath>
+#include <cstdlib>
 #include <filesystem>
 #include <functional>
 #include <memory>
 #include <string>
 #include <sys/ucontext.h>
-#include <thread>
 #include <vector>
 
 #include "astro/core/platform/LayerConfig.hpp"
@@ -21,6 +21,8 @@ using namespace astro::math;
 #define HEIGHT 600
 #define COLOR_DEPTH 24
 #define MAX_TEST_DURATION 20 // seconds
+#define MAX_HEADLESS_FRAMES 100 // frames rendered when there is no display
+#define TARGET_FPS 100 // frame rate limit with a display (unlimited when headless)
 
 // #define PROJECT_PATH "/home/ag6154lk/AstroBurrito"
 #define PROJECT_PATH "/home/alanglk/AstroBurrito"
@@ -43,17 +45,22 @@ Color blue  (0, 0, 255);
 // --- Helper functions ---
 #include "astro/core/platform/IPlatformLayer.hpp"
 #include "astro/core/platform/PlatformFactory.hpp"
+#include "astro/core/io/AssetLoader.hpp"
 #include "astro/core/io/PPMImage.hpp"
 #include "astro/core/io/TGAImage.hpp"
 #include "astro/core/io/OBJFile.hpp"
 #include "astro/core/camera/PerspectiveCamera.hpp"
+#include "astro/core/timing/FramePacer.hpp"
 using namespace astro::core::platform;
+using namespace astro::core::timing;
 
 class TestWindow {
 public:
     
     TestWindow(const std::string& window_name, int width, int height) {
-        console = PlatformFactory::getPlatform();
+        // Render offscreen at full speed on display-less machines
+        headless = std::getenv("DISPLAY") == nullptr;
+        console = PlatformFactory::getPlatform(headless ? PlatformType::Headless : PlatformType::Native);
         const LayerConfig layerConfig = {
             window_name,
             width,
@@ -62,12 +69,33 @@ public:
             LayerEventType::EvtNone
         };
         console->initialize(layerConfig);
+        pacer.setTargetFps(headless ? 0.0 : TARGET_FPS);
     }
     void showCanvas(const Texture& canvas){
-        console->render(canvas);
+        {
+            auto presentSection = pacer.section(FrameSection::Present);
+            console->render(canvas);
+        }
+        pacer.endFrame();
+        frames++;
+    }
+    ~TestWindow() {
+        const FrameStats stats = pacer.getStats();
+        std::cout << "[TestWindow] frame min/avg/p99: " << stats.minFrameMs << "/" << stats.avgFrameMs << "/" << stats.p99FrameMs
+                  << " ms | present " << stats.avgPresentMs << " ms\n";
     }
+    bool finished() const {
+        if (headless) return frames >= MAX_HEADLESS_FRAMES;
+        const auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - init_t).count();
+        return elapsed >= MAX_TEST_DURATION;
+    }
+    bool isHeadless() const { return headless; }
 private:
     std::unique_ptr<IPlatformLayer> console;
+    FramePacer pacer;
+    const std::chrono::steady_clock::time_point init_t = std::chrono::steady_clock::now();
+    bool headless = false;
+    int frames = 0;
 };
 
 
@@ -90,6 +118,203 @@ TEST(clearCanvas){
     return true;
 }
 
+TEST(textureDamage){
+    Texture canvas(WIDTH, HEIGHT);
+    ASSERT_EQ(damagedArea(canvas), WIDTH*HEIGHT); // New textures are fully damaged
+    
+    // Regions are clipped and covered ones are skipped
+    clearDamage(canvas);
+    ASSERT_EQ(damagedArea(canvas), 0);
+    markDamaged(canvas, -10, -10, 20, 20);
+    ASSERT_EQ(damagedArea(canvas), 100);
+    markDamaged(canvas, 2, 2, 4, 4);
+    ASSERT_EQ(canvas.damage.size(), 1);
+    markDamaged(canvas, -20, -20, 40, 40);
+    ASSERT_EQ(canvas.damage.size(), 1);
+    ASSERT_EQ(damagedArea(canvas), 400);
+    
+    // Too many regions collapse into their bounding box
+    clearDamage(canvas);
+    for (int i = 0; i <= Texture::MAX_DAMAGE_RECTS; i++) markDamaged(canvas, i * 10, 0, 1, 1);
+    ASSERT_EQ(canvas.damage.size(), 1);
+    ASSERT_EQ(canvas.damage[0].width, Texture::MAX_DAMAGE_RECTS * 10 + 1);
+    
+    // Drawing functions report what they touch
+    clearDamage(canvas);
+    draw2dLine(canvas, 10, 20, 30, 25, red);
+    ASSERT_EQ(damagedArea(canvas), 21 * 6);
+    clearDamage(canvas);
+    draw2dTriangle(canvas, 10, 10, 20, 10, 10, 20, red);
+    ASSERT_EQ(damagedArea(canvas), 11 * 11);
+    clearTexture(canvas, black);
+    ASSERT_EQ(damagedArea(canvas), WIDTH*HEIGHT);
+    return true;
+}
+
+TEST(meshVertexBatch){
+    // Procedural grid (vertex count is not a multiple of the SIMD width)
+    const int GRID = 21;
+    std::vector<VertexAttributes> vertices;
+    std::vector<uint32_t> indices;
+    for (int j = 0; j < GRID; j++) {
+        for (int i = 0; i < GRID; i++) {
+            VertexAttributes vert;
+            float x = -1.0f + 2.0f * i / (GRID - 1);
+            float y = -1.0f + 2.0f * j / (GRID - 1);
+            vert.pos = Vec4f(x, y, 0.3f * std::sin(3.0f * x) * std::cos(2.0f * y), 1.0f);
+            vert.uv = Vec2f(i / float(GRID - 1), j / float(GRID - 1));
+            vert.normal = normalize(Vec3f(x, y, 1.0f));
+            vert.tangent = Vec3f(1.0f, 0.0f, -x);
+            vertices.push_back(vert);
+        }
+    }
+    for (int j = 0; j < GRID - 1; j++) {
+        for (int i = 0; i < GRID - 1; i++) {
+            uint32_t a = j * GRID + i;
+            indices.insert(indices.end(), {a, a + 1, a + GRID, a + 1, a + GRID + 1, a + GRID});
+        }
+    }
+
+    astro::core::camera::PerspectiveCamera camera(WIDTH, HEIGHT, 60.);
+    camera.lookAt({0.5, 0.3, 3.}, {0., 0., 0.}, {0., 1., 0.});
+    BasicShader shader;
+    shader.projectionMatrix = camera.getProjectionMatrix();
+    shader.viewMatrix = camera.getViewMatrix();
+    shader.modelMatrix = Mat4f::Identity();
+    shader.updateMVP();
+
+    // Batched vertex stage matches the per-vertex one
+    VaryingsBatch batch;
+    shader.vertexBatch(vertices.data(), vertices.size(), batch);
+    ASSERT_EQ(batch.size(), vertices.size());
+    auto close = [](float a, float b) { return std::fabs(a - b) < 1e-4f * std::max(1.0f, std::fabs(b)); };
+    for (size_t i = 0; i < vertices.size(); i++) {
+        Varyings expected;
+        ASSERT_TRUE(shader.vertex(vertices[i], expected));
+        Varyings got = batch.get(i);
+        ASSERT_TRUE(batch.valid[i]);
+        for (int k = 0; k < 4; k++) ASSERT_TRUE(close(got.pos[k], expected.pos[k]));
+        for (int k = 0; k < 3; k++) {
+            ASSERT_TRUE(close(got.worldPos[k], expected.worldPos[k]));
+            ASSERT_TRUE(close(got.normal[k], expected.normal[k]));
+            ASSERT_TRUE(close(got.tangent[k], expected.tangent[k]));
+        }
+        ASSERT_EQ(got.uv, expected.uv);
+    }
+
+    // Indexed rendering matches triangle by triangle rendering
+    Texture expectedCanvas(WIDTH, HEIGHT);
+    Texture canvas(WIDTH, HEIGHT);
+    ZBuffer zbuffer(WIDTH, HEIGHT);
+    clearTexture(expectedCanvas, black);
+    clearZBuffer(zbuffer);
+    for (size_t i = 0; i < indices.size(); i += 3) {
+        Triangle triangle = {vertices[indices[i]], vertices[indices[i + 1]], vertices[indices[i + 2]]};
+        TDRenderer::renderTriangle(expectedCanvas, zbuffer, triangle, shader);
+    }
+    clearTexture(canvas, black);
+    clearZBuffer(zbuffer);
+    TDRenderer::renderMesh(canvas, zbuffer, vertices, indices, shader);
+
+    long covered = 0, mismatched = 0;
+    for (size_t i = 0; i < canvas.data.size(); i++) {
+        covered += canvas.data[i] != black;
+        mismatched += canvas.data[i] != expectedCanvas.data[i];
+    }
+    ASSERT_TRUE(covered > 1000);
+    ASSERT_TRUE(mismatched * 1000 < covered); // Only rounding differences on triangle edges
+    return true;
+}
+
+TEST(shaderTransformTypes){
+    astro::core::camera::PerspectiveCamera camera(WIDTH, HEIGHT, 60.);
+    camera.lookAt({1.0, 0.5, 3.}, {0., 0., 0.}, {0., 1., 0.});
+    Mat4f model({
+        2.0f, 0.3f, 0.0f, 0.5f,
+        0.0f, 0.5f, 0.0f, 1.0f,
+        0.0f, 0.0f, 1.5f, -1.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    });
+
+    BasicShader general;
+    general.projectionMatrix = camera.getProjectionMatrix();
+    general.viewMatrix = camera.getViewMatrix();
+    general.modelMatrix = model;
+    general.updateMVP();
+
+    // Declared transform types must produce the same varyings
+    BasicShader declared = general;
+    declared.viewTransform = TransformType::Rigid;
+    declared.modelTransform = TransformType::Affine;
+    declared.updateMVP();
+    BasicShader rigid = general;
+    rigid.modelMatrix = Mat4f::Identity();
+    rigid.updateMVP();
+    BasicShader rigidDeclared = rigid;
+    rigidDeclared.modelTransform = TransformType::Rigid;
+    rigidDeclared.viewTransform = TransformType::Rigid;
+    rigidDeclared.updateMVP();
+
+    VertexAttributes vert;
+    vert.pos = Vec4f(0.3f, -0.2f, 0.1f, 1.0f);
+    vert.uv = Vec2f(0.0f);
+    vert.normal = normalize(Vec3f(0.2f, 1.0f, 0.4f));
+    vert.tangent = Vec3f(1.0f, 0.0f, 0.0f);
+    for (auto [a, b] : {std::make_pair(&general, &declared), std::make_pair(&rigid, &rigidDeclared)}) {
+        Varyings expected, got;
+        a->vertex(vert, expected);
+        b->vertex(vert, got);
+        for (int k = 0; k < 3; k++) {
+            ASSERT_TRUE(std::fabs(got.normal[k] - expected.normal[k]) < 1e-4f);
+            ASSERT_TRUE(std::fabs(got.tangent[k] - expected.tangent[k]) < 1e-4f);
+        }
+    }
+    return true;
+}
+
+TEST(phongFastQuality){
+    // Fast shading math must match the exact shading within 8 bit rounding
+    PhongShader shader;
+    shader.material = std::make_shared<Material>();
+    shader.material->shininess = 64.0f;
+    shader.material->diffuseCoeff = 0.8f;
+    shader.material->specularCoeff = 0.6f;
+    shader.material->color = Vec4f(0.9f, 0.7f, 0.5f, 1.0f);
+    shader.cameraPos = Vec3f(0.0f, 0.5f, 3.0f);
+    Light sun;
+    sun.type = Light::DIRECTIONAL;
+    sun.color = Vec4f(1.0f, 1.0f, 0.9f, 1.0f);
+    sun.worldDir = Vec3f(-0.3f, -1.0f, -0.5f);
+    sun.intensity = 1.0f;
+    Light lamp;
+    lamp.type = Light::POINT;
+    lamp.color = Vec4f(0.4f, 0.4f, 1.0f, 1.0f);
+    lamp.worldPos = Vec3f(0.5f, 1.0f, 1.0f);
+    lamp.intensity = 3.0f;
+    lamp.range = 10.0f;
+    shader.sceneLights = {sun, lamp};
+
+    for (int i = 0; i < 256; i++) {
+        const float t = static_cast<float>(i) / 255.0f;
+        Varyings frag;
+        frag.uv = Vec2f(t, 1.0f - t);
+        frag.worldPos = Vec4f(t - 0.5f, 0.3f - t, 0.2f * t, 1.0f);
+        frag.normal = Vec3f(0.4f * t - 0.2f, 1.0f, 0.8f - t);
+        frag.tangent = Vec3f(1.0f, 0.0f, 0.0f);
+
+        Color exact, fast;
+        shader.material->quality = ShadingQuality::Exact;
+        ASSERT_TRUE(shader.fragment(frag, exact));
+        shader.material->quality = ShadingQuality::Fast;
+        ASSERT_TRUE(shader.fragment(frag, fast));
+        ASSERT_TRUE(std::abs(exact.r - fast.r) <= 1);
+        ASSERT_TRUE(std::abs(exact.g - fast.g) <= 1);
+        ASSERT_TRUE(std::abs(exact.b - fast.b) <= 1);
+        ASSERT_EQ(exact.a, fast.a);
+    }
+    return true;
+}
+
 TEST(lineDrawing){
     // Create canvas
     Texture canvas(WIDTH, HEIGHT);
@@ -106,7 +331,6 @@ TEST(lineDrawing){
 
     // Main loop
     int i = 0;
-    const auto init_t = std::chrono::steady_clock::now();
     while(true){
         clearTexture(canvas,  gray);
 
@@ -122,12 +346,8 @@ TEST(lineDrawing){
         // Render on window
         window.showCanvas(canvas);
 
-        // Check for ellapsed time
-        const auto now = std::chrono::steady_clock::now();
-        const auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - init_t).count();
-        if (elapsed >= MAX_TEST_DURATION) break;
-
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        // Check for ellapsed time (or frame budget when headless)
+        if (window.finished()) break;
         i++;
     }
     
@@ -160,7 +380,6 @@ TEST(wireframeDrawing){
     
     // Main loop
     int i = 0;
-    const auto init_t = std::chrono::steady_clock::now();
     while(true){
         clearTexture(canvas, gray);
         
@@ -195,12 +414,8 @@ TEST(wireframeDrawing){
         // Show on window
         window.showCanvas(canvas);
 
-        // Check for ellapsed time
-        const auto now = std::chrono::steady_clock::now();
-        const auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - init_t).count();
-        if (elapsed >= MAX_TEST_DURATION) break;
-
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        // Check for ellapsed time (or frame budget when headless)
+        if (window.finished()) break;
         i++;
     }
     
@@ -237,10 +452,11 @@ TEST(perspectiveCamera) {
     BasicShader shader;
     shader.projectionMatrix = camera.getProjectionMatrix();
     shader.modelMatrix = Mat4f::Identity();
+    shader.modelTransform = TransformType::Rigid;
+    shader.viewTransform = TransformType::Rigid; // lookAt() view
     
     // Main loop
     int i = 0;
-    const auto init_t = std::chrono::steady_clock::now();
     while(true){
         clearTexture(canvas, gray);
         clearZBuffer(zbuffer);
@@ -269,12 +485,8 @@ TEST(perspectiveCamera) {
         // Show on window
         window.showCanvas(canvas);
 
-        // Check for ellapsed time
-        const auto now = std::chrono::steady_clock::now();
-        const auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - init_t).count();
-        if (elapsed >= MAX_TEST_DURATION) break;
-
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        // Check for ellapsed time (or frame budget when headless)
+        if (window.finished()) break;
         i++;
     }
     
@@ -291,12 +503,16 @@ TEST(textureModel) {
     ZBuffer zbuffer(WIDTH, HEIGHT);
     TestWindow window("textureModel", WIDTH, HEIGHT);
     
-    // Load assets
-    const auto diablo_diff = astro::core::io::TGAImage::readImage(DIABLO_DIFF_PATH);
-    const auto diablo_spec = astro::core::io::TGAImage::readImage(DIABLO_SPEC_PATH);
-    const auto diablo_nm_tangent = astro::core::io::TGAImage::readImage(DIABLO_NM_TAN_PATH);
-    const auto diablo_glow = astro::core::io::TGAImage::readImage(DIABLO_GLOW_PATH);
-    const astro::core::io::OBJFile diablo_obj(DIABLO_OBJ_PATH);
+    // Load assets in the background: the loop renders a placeholder until they arrive
+    astro::core::io::AssetLoader loader;
+    const auto diablo_diff = loader.loadImage(DIABLO_DIFF_PATH);
+    const auto diablo_spec = loader.loadImage(DIABLO_SPEC_PATH);
+    const auto diablo_nm_tangent = loader.loadImage(DIABLO_NM_TAN_PATH);
+    const auto diablo_glow = loader.loadImage(DIABLO_GLOW_PATH);
+    const auto diablo_mesh = loader.loadOBJ(DIABLO_OBJ_PATH);
+    // Headless runs stop after a frame count, not a duration: render the loaded model on every
+    // frame so the output does not depend on how fast the assets load
+    if (window.isHeadless()) loader.wait();
 
     // Create Camera
     astro::core::camera::PerspectiveCamera camera(WIDTH, HEIGHT, 60.);
@@ -314,10 +530,6 @@ TEST(textureModel) {
     mat.diffuseCoeff    = 1.0f;
     mat.specularCoeff   = 5.0f;
     mat.oppacity        = 1.0f;
-    mat.colorTexture    = std::make_shared<Texture>(diablo_diff);
-    mat.specularMap     = std::make_shared<Texture>(diablo_spec);
-    mat.normalMap       = std::make_shared<Texture>(diablo_nm_tangent);
-    mat.glowMap         = std::make_shared<Texture>(diablo_glow);
     
     Light torch;
     torch.type = Light::POINT;
@@ -335,6 +547,8 @@ TEST(textureModel) {
     PhongShader shader;
     shader.projectionMatrix = camera.getProjectionMatrix();
     shader.modelMatrix = Mat4f::Identity();
+    shader.modelTransform = TransformType::Rigid;
+    shader.viewTransform = TransformType::Rigid; // lookAt() view
     shader.material = std::make_shared<Material>(mat);
     shader.sceneLights.push_back(torch);
     shader.sceneLights.push_back(sun);
@@ -342,7 +556,6 @@ TEST(textureModel) {
     
     // Main loop
     int i = 0;
-    const auto init_t = std::chrono::steady_clock::now();
     while(true){
         clearTexture(canvas, gray);
         clearZBuffer(zbuffer);
@@ -357,30 +570,40 @@ TEST(textureModel) {
         shader.cameraPos = camera.getEye();
         shader.updateMVP();
 
-        // Render triangles
-        for (size_t i = 0; i < diablo_obj.indices.size(); i += 3) {
-
-            // Get triangle data
-            const VertexAttributes& v0 = diablo_obj.vertices[diablo_obj.indices[i]];
-            const VertexAttributes& v1 = diablo_obj.vertices[diablo_obj.indices[i + 1]];
-            const VertexAttributes& v2 = diablo_obj.vertices[diablo_obj.indices[i + 2]];
-            Triangle triangle = {v0, v1, v2 };
-            
-            // Render triangle
-            TDRenderer::renderTriangle(canvas, zbuffer, triangle, shader);
+        // Textures stream in as they finish loading (flat material color until then)
+        shader.material->colorTexture = diablo_diff.tryGet();
+        shader.material->specularMap  = diablo_spec.tryGet();
+        shader.material->normalMap    = diablo_nm_tangent.tryGet();
+        shader.material->glowMap      = diablo_glow.tryGet();
+
+        // Render triangles (placeholder: nothing until the mesh is loaded)
+        if (const auto diablo_obj = diablo_mesh.tryGet()) {
+            for (size_t i = 0; i < diablo_obj->indices.size(); i += 3) {
+
+                // Get triangle data
+                const VertexAttributes& v0 = diablo_obj->vertices[diablo_obj->indices[i]];
+                const VertexAttributes& v1 = diablo_obj->vertices[diablo_obj->indices[i + 1]];
+                const VertexAttributes& v2 = diablo_obj->vertices[diablo_obj->indices[i + 2]];
+                Triangle triangle = {v0, v1, v2 };
+
+                // Render triangle
+                TDRenderer::renderTriangle(canvas, zbuffer, triangle, shader);
+            }
+        } else {
+            draw2dLine(canvas, WIDTH / 4, HEIGHT / 2, WIDTH / 4 + (i % (WIDTH / 2)), HEIGHT / 2, white);
         }
         
         // Show on window
         window.showCanvas(canvas);
 
-        // Check for ellapsed time
-        const auto now = std::chrono::steady_clock::now();
-        const auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - init_t).count();
-        if (elapsed >= MAX_TEST_DURATION) break;
-
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        // Check for ellapsed time (or frame budget when headless)
+        if (window.finished()) break;
         i++;
     }
+
+    // Report loading errors (a failed asset only shows up as a missing texture in the loop)
+    for (const auto& texture : {diablo_diff, diablo_spec, diablo_nm_tangent, diablo_glow}) texture.get();
+    diablo_mesh.get();
     
     astro::core::io::PPMImage::writeImage("./graphics_camera_test.ppm", canvas);
     return true;
@@ -0,0 +1,531 @@
+#pragma once
+
+#include "astro/math/math.hpp"
+#include "astro/math/simd.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+
+namespace astro {
+namespace math {
+
+// ========================================================
+// --- BATCH (SoA) ----------------------------------------
+// ========================================================
+// W lanes of float processed at once. Every operation works lane-wise, so a block of
+// pixels or vertices can be shaded/transformed in a single call.
+// Built on GCC/Clang vector extensions: they map to SSE/AVX/AVX-512/NEON depending on the
+// target flags (wider types are split into native registers by the compiler).
+namespace detail {
+    // Native vector types per width (sizes must be non-dependent for the vector_size attribute)
+    template<int W> struct BatchTypes;
+    template<> struct BatchTypes<4> {
+        typedef float   f32 __attribute__((vector_size(16)));
+        typedef int32_t i32 __attribute__((vector_size(16)));
+    };
+    template<> struct BatchTypes<8> {
+        typedef float   f32 __attribute__((vector_size(32)));
+        typedef int32_t i32 __attribute__((vector_size(32)));
+    };
+    template<> struct BatchTypes<16> {
+        typedef float   f32 __attribute__((vector_size(64)));
+        typedef int32_t i32 __attribute__((vector_size(64)));
+    };
+}
+
+template<int W>
+struct FloatN {
+    static_assert(W == 4 || W == 8 || W == 16, "Batch width must be 4, 8 or 16 lanes");
+    using value_type = float;
+    static constexpr int lanes = W;
+    typedef typename detail::BatchTypes<W>::f32 native;
+
+    native v;
+
+    FloatN() = default; // No initialization
+    FloatN(float val) { v = native{} + val; } // Scalar fill (broadcast)
+    FloatN(const native& val) : v(val) {}
+
+    /**
+     * @brief Load W consecutive floats
+     * @param src pointer to W floats (no alignment requirement)
+     */
+    static FloatN load(const float* src) {
+        FloatN res;
+        __builtin_memcpy(&res.v, src, sizeof(native));
+        return res;
+    }
+    void store(float* dst) const { __builtin_memcpy(dst, &v, sizeof(native)); }
+
+    // Lane access operators
+    float operator[](int i) const { return v[i]; }
+    void set(int i, float val) { v[i] = val; }
+
+    // Compound assignment operators
+    FloatN& operator+=(const FloatN& b) { v += b.v; return *this; }
+    FloatN& operator-=(const FloatN& b) { v -= b.v; return *this; }
+    FloatN& operator*=(const FloatN& b) { v *= b.v; return *this; }
+    FloatN& operator/=(const FloatN& b) { v /= b.v; return *this; }
+};
+
+template<int W>
+struct MaskN {
+    typedef typename detail::BatchTypes<W>::i32 native;
+
+    native m; // Every lane is either 0 (false) or ~0 (true)
+
+    MaskN() = default; // No initialization
+    MaskN(bool val) { m = native{} + (val ? -1 : 0); }
+    MaskN(const native& val) : m(val) {}
+
+    bool operator[](int i) const { return m[i] != 0; }
+};
+
+typedef FloatN<4>  Floatx4;
+typedef FloatN<8>  Floatx8;
+typedef FloatN<16> Floatx16;
+typedef MaskN<4>   Maskx4;
+typedef MaskN<8>   Maskx8;
+typedef MaskN<16>  Maskx16;
+
+// FloatN Operators
+template<int W> FloatN<W> operator-(const FloatN<W>& a) { return FloatN<W>(-a.v); }
+template<int W> FloatN<W> operator+(const FloatN<W>& a, const FloatN<W>& b) { return FloatN<W>(a.v + b.v); }
+template<int W> FloatN<W> operator-(const FloatN<W>& a, const FloatN<W>& b) { return FloatN<W>(a.v - b.v); }
+template<int W> FloatN<W> operator*(const FloatN<W>& a, const FloatN<W>& b) { return FloatN<W>(a.v * b.v); }
+template<int W> FloatN<W> operator/(const FloatN<W>& a, const FloatN<W>& b) { return FloatN<W>(a.v / b.v); }
+template<int W> FloatN<W> operator+(const FloatN<W>& a, float b) { return FloatN<W>(a.v + b); }
+template<int W> FloatN<W> operator-(const FloatN<W>& a, float b) { return FloatN<W>(a.v - b); }
+template<int W> FloatN<W> operator*(const FloatN<W>& a, float b) { return FloatN<W>(a.v * b); }
+template<int W> FloatN<W> operator/(const FloatN<W>& a, float b) { return FloatN<W>(a.v / b); }
+template<int W> FloatN<W> operator+(float a, const FloatN<W>& b) { return FloatN<W>(a + b.v); }
+template<int W> FloatN<W> operator-(float a, const FloatN<W>& b) { return FloatN<W>(a - b.v); }
+template<int W> FloatN<W> operator*(float a, const FloatN<W>& b) { return FloatN<W>(a * b.v); }
+template<int W> FloatN<W> operator/(float a, const FloatN<W>& b) { return FloatN<W>(a / b.v); }
+
+// Lane-wise comparisons
+template<int W> MaskN<W> operator< (const FloatN<W>& a, const FloatN<W>& b) { return MaskN<W>(a.v <  b.v); }
+template<int W> MaskN<W> operator<=(const FloatN<W>& a, const FloatN<W>& b) { return MaskN<W>(a.v <= b.v); }
+template<int W> MaskN<W> operator> (const FloatN<W>& a, const FloatN<W>& b) { return MaskN<W>(a.v >  b.v); }
+template<int W> MaskN<W> operator>=(const FloatN<W>& a, const FloatN<W>& b) { return MaskN<W>(a.v >= b.v); }
+template<int W> MaskN<W> operator==(const FloatN<W>& a, const FloatN<W>& b) { return MaskN<W>(a.v == b.v); }
+template<int W> MaskN<W> operator!=(const FloatN<W>& a, const FloatN<W>& b) { return MaskN<W>(a.v != b.v); }
+template<int W> MaskN<W> operator< (const FloatN<W>& a, float b) { return a <  FloatN<W>(b); }
+template<int W> MaskN<W> operator<=(const FloatN<W>& a, float b) { return a <= FloatN<W>(b); }
+template<int W> MaskN<W> operator> (const FloatN<W>& a, float b) { return a >  FloatN<W>(b); }
+template<int W> MaskN<W> operator>=(const FloatN<W>& a, float b) { return a >= FloatN<W>(b); }
+template<int W> MaskN<W> operator==(const FloatN<W>& a, float b) { return a == FloatN<W>(b); }
+template<int W> MaskN<W> operator!=(const FloatN<W>& a, float b) { return a != FloatN<W>(b); }
+
+// Mask Operators
+template<int W> MaskN<W> operator&(const MaskN<W>& a, const MaskN<W>& b) { return MaskN<W>(a.m & b.m); }
+template<int W> MaskN<W> operator|(const MaskN<W>& a, const MaskN<W>& b) { return MaskN<W>(a.m | b.m); }
+template<int W> MaskN<W> operator^(const MaskN<W>& a, const MaskN<W>& b) { return MaskN<W>(a.m ^ b.m); }
+template<int W> MaskN<W> operator~(const MaskN<W>& a) { return MaskN<W>(~a.m); }
+
+/**
+ * @brief Bitmask with one bit per lane (bit i set if lane i is true)
+ * @return uint32_t
+ */
+template<int W>
+uint32_t bits(const MaskN<W>& mask) {
+    uint32_t res = 0;
+    for (int i = 0; i < W; ++i) res |= static_cast<uint32_t>(mask.m[i] & 1) << i;
+    return res;
+}
+template<int W> bool any(const MaskN<W>& mask) { return bits(mask) != 0; }
+template<int W> bool all(const MaskN<W>& mask) { return bits(mask) == (1u << W) - 1u; }
+template<int W> bool none(const MaskN<W>& mask) { return bits(mask) == 0; }
+
+/**
+ * @brief Lane-wise choice: a where the mask is set, b elsewhere
+ * @return FloatN<W>
+ */
+template<int W>
+FloatN<W> select(const MaskN<W>& mask, const FloatN<W>& a, const FloatN<W>& b) {
+    // Casts between vector types of the same size reinterpret the bits
+    typedef typename MaskN<W>::native bits_t;
+    const bits_t res = ((bits_t)a.v & mask.m) | ((bits_t)b.v & ~mask.m);
+    return FloatN<W>((typename FloatN<W>::native)res);
+}
+
+template<int W> FloatN<W> min(const FloatN<W>& a, const FloatN<W>& b) { return select(a < b, a, b); }
+template<int W> FloatN<W> max(const FloatN<W>& a, const FloatN<W>& b) { return select(a > b, a, b); }
+template<int W> FloatN<W> clamp(const FloatN<W>& a, float lo, float hi) { return min(max(a, FloatN<W>(lo)), FloatN<W>(hi)); }
+template<int W> FloatN<W> abs(const FloatN<W>& a) {
+    typedef typename MaskN<W>::native bits_t;
+    return FloatN<W>((typename FloatN<W>::native)((bits_t)a.v & 0x7fffffff)); // Clear the sign bit
+}
+
+template<int W>
+FloatN<W> sqrt(const FloatN<W>& a) {
+    // No generic vector sqrt builtin. Processed in 4-lane registers
+    alignas(16) float in[W];
+    alignas(16) float out[W];
+    a.store(in);
+    for (int i = 0; i < W; i += 4) simd::store(&out[i], simd::sqrt(simd::load(&in[i])));
+    return FloatN<W>::load(out);
+}
+
+template<int W>
+std::ostream& operator<<(std::ostream& os, const FloatN<W>& a) {
+    os << '[';
+    for (int i = 0; i < W; i++) {
+        os << a[i];
+        if (i != W - 1) os << ", ";
+    }
+    os << ']';
+    return os;
+}
+
+
+/**
+ * @brief W vectors of N components in SoA layout: component c of every lane is stored
+ * contiguously in data[c]. Same operator set as Vector<float, N>, evaluated lane-wise.
+ */
+template<int N, int W>
+struct VectorN {
+    static_assert(N >= 2 && N <= 4, "Batch vectors have 2, 3 or 4 components");
+    using value_type = FloatN<W>;
+    static constexpr int rows = N;
+    static constexpr int lanes = W;
+
+    FloatN<W> data[N];
+
+    VectorN() = default; // No initialization
+    VectorN(float val) { for (int c = 0; c < N; c++) data[c] = FloatN<W>(val); } // Scalar fill
+    VectorN(const Vector<float, N>& vec) { for (int c = 0; c < N; c++) data[c] = FloatN<W>(vec[c]); } // Broadcast a vector
+    VectorN(const FloatN<W>& x, const FloatN<W>& y) requires (N == 2) : data{x, y} {}
+    VectorN(const FloatN<W>& x, const FloatN<W>& y, const FloatN<W>& z) requires (N == 3) : data{x, y, z} {}
+    VectorN(const FloatN<W>& x, const FloatN<W>& y, const FloatN<W>& z, const FloatN<W>& w) requires (N == 4) : data{x, y, z, w} {}
+
+    /**
+     * @brief Gather W AoS vectors into SoA lanes
+     * @param src pointer to W consecutive vectors
+     */
+    static VectorN load(const Vector<float, N>* src) {
+        VectorN res;
+        for (int c = 0; c < N; c++)
+            for (int i = 0; i < W; i++) res.data[c].set(i, src[i][c]);
+        return res;
+    }
+    /**
+     * @brief Scatter the lanes back to W AoS vectors
+     * @param dst pointer to W consecutive vectors
+     */
+    void store(Vector<float, N>* dst) const {
+        for (int c = 0; c < N; c++)
+            for (int i = 0; i < W; i++) dst[i][c] = data[c][i];
+    }
+
+    // Component access operators
+    FloatN<W>& operator[](int c) { return data[c]; }
+    const FloatN<W>& operator[](int c) const { return data[c]; }
+    FloatN<W>& x() { return data[0]; }
+    FloatN<W>& y() { return data[1]; }
+    FloatN<W>& z() requires (N >= 3) { return data[2]; }
+    FloatN<W>& w() requires (N >= 4) { return data[3]; }
+    const FloatN<W>& x() const { return data[0]; }
+    const FloatN<W>& y() const { return data[1]; }
+    const FloatN<W>& z() const requires (N >= 3) { return data[2]; }
+    const FloatN<W>& w() const requires (N >= 4) { return data[3]; }
+
+    // Lane access
+    Vector<float, N> lane(int i) const {
+        Vector<float, N> res;
+        for (int c = 0; c < N; c++) res[c] = data[c][i];
+        return res;
+    }
+    void setLane(int i, const Vector<float, N>& vec) {
+        for (int c = 0; c < N; c++) data[c].set(i, vec[c]);
+    }
+};
+
+// Common type definitions
+typedef VectorN<2, 4>  Vec2fx4;
+typedef VectorN<2, 8>  Vec2fx8;
+typedef VectorN<2, 16> Vec2fx16;
+typedef VectorN<3, 4>  Vec3fx4;
+typedef VectorN<3, 8>  Vec3fx8;
+typedef VectorN<3, 16> Vec3fx16;
+typedef VectorN<4, 4>  Vec4fx4;
+typedef VectorN<4, 8>  Vec4fx8;
+typedef VectorN<4, 16> Vec4fx16;
+
+// Batch Vector Operators
+template<int N, int W>
+VectorN<N, W> operator-(const VectorN<N, W>& a) {
+    VectorN<N, W> res;
+    for (int c = 0; c < N; c++) res.data[c] = -a.data[c];
+    return res;
+}
+
+/**
+ * @brief Element wise batch vector sum
+ * @return VectorN<N, W>
+ */
+template<int N, int W>
+VectorN<N, W> operator+(const VectorN<N, W>& a, const VectorN<N, W>& b) {
+    VectorN<N, W> res;
+    for (int c = 0; c < N; c++) res.data[c] = a.data[c] + b.data[c];
+    return res;
+}
+/**
+ * @brief Element wise batch vector difference
+ * @return VectorN<N, W>
+ */
+template<int N, int W>
+VectorN<N, W> operator-(const VectorN<N, W>& a, const VectorN<N, W>& b) {
+    VectorN<N, W> res;
+    for (int c = 0; c < N; c++) res.data[c] = a.data[c] - b.data[c];
+    return res;
+}
+/**
+ * @brief Element wise batch vector product
+ * @return VectorN<N, W>
+ */
+template<int N, int W>
+VectorN<N, W> operator*(const VectorN<N, W>& a, const VectorN<N, W>& b) {
+    VectorN<N, W> res;
+    for (int c = 0; c < N; c++) res.data[c] = a.data[c] * b.data[c];
+    return res;
+}
+/**
+ * @brief Element wise batch vector division (lanes dividing by 0 follow IEEE rules)
+ * @return VectorN<N, W>
+ */
+template<int N, int W>
+VectorN<N, W> operator/(const VectorN<N, W>& a, const VectorN<N, W>& b) {
+    VectorN<N, W> res;
+    for (int c = 0; c < N; c++) res.data[c] = a.data[c] / b.data[c];
+    return res;
+}
+
+/**
+ * @brief Per-lane scalar product (each lane scaled by its own factor)
+ * @return VectorN<N, W>
+ */
+template<int N, int W>
+VectorN<N, W> operator*(const VectorN<N, W>& a, const FloatN<W>& s) {
+    VectorN<N, W> res;
+    for (int c = 0; c < N; c++) res.data[c] = a.data[c] * s;
+    return res;
+}
+template<int N, int W>
+VectorN<N, W> operator*(const FloatN<W>& s, const VectorN<N, W>& a) { return a * s; }
+template<int N, int W>
+VectorN<N, W> operator/(const VectorN<N, W>& a, const FloatN<W>& s) {
+    VectorN<N, W> res;
+    for (int c = 0; c < N; c++) res.data[c] = a.data[c] / s;
+    return res;
+}
+template<int N, int W>
+VectorN<N, W> operator+(const VectorN<N, W>& a, float val) {
+    VectorN<N, W> res;
+    for (int c = 0; c < N; c++) res.data[c] = a.data[c] + val;
+    return res;
+}
+template<int N, int W>
+VectorN<N, W> operator-(const VectorN<N, W>& a, float val) { return a + (-val); }
+template<int N, int W>
+VectorN<N, W> operator*(const VectorN<N, W>& a, float val) { return a * FloatN<W>(val); }
+template<int N, int W>
+VectorN<N, W> operator/(const VectorN<N, W>& a, float val) ASTRO_MATH_NOEXCEPT {
+    ASTRO_MATH_CHECK(val != 0.0f, std::runtime_error, "Division by 0");
+    return a * (1.0f / val);
+}
+
+/**
+ * @brief Lane-wise dot product
+ * @return FloatN<W>
+ */
+template<int N, int W>
+FloatN<W> dot(const VectorN<N, W>& a, const VectorN<N, W>& b) {
+    FloatN<W> res = a.data[0] * b.data[0];
+    for (int c = 1; c < N; c++) res += a.data[c] * b.data[c];
+    return res;
+}
+
+/**
+ * @brief Lane-wise cross product (4 components: cross of xyz, w = 0)
+ * @return VectorN<N, W>
+ */
+template<int N, int W>
+requires (N == 3 || N == 4)
+VectorN<N, W> cross(const VectorN<N, W>& a, const VectorN<N, W>& b) {
+    VectorN<N, W> res;
+    res.data[0] = a.data[1] * b.data[2] - a.data[2] * b.data[1];
+    res.data[1] = a.data[2] * b.data[0] - a.data[0] * b.data[2];
+    res.data[2] = a.data[0] * b.data[1] - a.data[1] * b.data[0];
+    if constexpr (N == 4) res.data[3] = FloatN<W>(0.0f);
+    return res;
+}
+
+template<int N, int W>
+FloatN<W> len(const VectorN<N, W>& vec) { return sqrt(dot(vec, vec)); }
+
+/**
+ * @brief Lane-wise normalization. Like normalize(Vector), zero-length lanes throw when
+ * ASTRO_MATH_CHECKED is on (mask inactive lanes out with select() first)
+ * @return VectorN<N, W>
+ */
+template<int N, int W>
+VectorN<N, W> normalize(const VectorN<N, W>& vec) ASTRO_MATH_NOEXCEPT {
+    const FloatN<W> length = len(vec);
+    ASTRO_MATH_CHECK(!any(length == 0.0f), std::runtime_error, "Cannot normalize zero-length vector");
+    return vec * (1.0f / length);
+}
+
+/**
+ * @brief Lane-wise choice between two batch vectors
+ * @return VectorN<N, W>
+ */
+template<int N, int W>
+VectorN<N, W> select(const MaskN<W>& mask, const VectorN<N, W>& a, const VectorN<N, W>& b) {
+    VectorN<N, W> res;
+    for (int c = 0; c < N; c++) res.data[c] = select(mask, a.data[c], b.data[c]);
+    return res;
+}
+
+// Batch Matrix Operators (the same matrix applied to every lane)
+/**
+ * @brief Transforms W vectors by a 4x4 matrix
+ * @return VectorN<4, W>
+ */
+template<int W>
+VectorN<4, W> operator*(const Mat4f& A, const VectorN<4, W>& v) {
+    VectorN<4, W> res;
+    for (int r = 0; r < 4; r++) {
+        const float* row = &A.data[r * 4];
+        res.data[r] = v.data[0] * row[0] + v.data[1] * row[1] + v.data[2] * row[2] + v.data[3] * row[3];
+    }
+    return res;
+}
+
+/**
+ * @brief Transforms W vectors by a 3x3 matrix
+ * @return VectorN<3, W>
+ */
+template<int W>
+VectorN<3, W> operator*(const Mat3f& A, const VectorN<3, W>& v) {
+    VectorN<3, W> res;
+    for (int r = 0; r < 3; r++) {
+        const float* row = &A.data[r * 3];
+        res.data[r] = v.data[0] * row[0] + v.data[1] * row[1] + v.data[2] * row[2];
+    }
+    return res;
+}
+
+/**
+ * @brief Transforms W points (implicit w = 1) by a 4x4 matrix
+ * @return VectorN<4, W> homogeneous result
+ */
+template<int W>
+VectorN<4, W> transformPoint(const Mat4f& A, const VectorN<3, W>& p) {
+    VectorN<4, W> res;
+    for (int r = 0; r < 4; r++) {
+        const float* row = &A.data[r * 4];
+        res.data[r] = p.data[0] * row[0] + p.data[1] * row[1] + p.data[2] * row[2] + row[3];
+    }
+    return res;
+}
+
+/**
+ * @brief Transforms W directions (implicit w = 0) by the upper 3x3 block of a 4x4 matrix
+ * @return VectorN<3, W>
+ */
+template<int W>
+VectorN<3, W> transformDir(const Mat4f& A, const VectorN<3, W>& d) {
+    VectorN<3, W> res;
+    for (int r = 0; r < 3; r++) {
+        const float* row = &A.data[r * 4];
+        res.data[r] = d.data[0] * row[0] + d.data[1] * row[1] + d.data[2] * row[2];
+    }
+    return res;
+}
+
+/**
+ * @brief W square N x N matrices in SoA layout: element (r, c) of every lane is stored in data[r * N + c]
+ */
+template<int N, int W>
+struct MatrixN {
+    static_assert(N >= 2 && N <= 4, "Batch matrices are 2x2, 3x3 or 4x4");
+    static constexpr int rows = N;
+    static constexpr int cols = N;
+    static constexpr int lanes = W;
+
+    FloatN<W> data[N * N];
+
+    MatrixN() = default; // No initialization
+    MatrixN(float val) { for (int i = 0; i < N * N; i++) data[i] = FloatN<W>(val); } // Scalar fill
+
+    FloatN<W>& operator()(int r, int c) { return data[r * N + c]; }
+    const FloatN<W>& operator()(int r, int c) const { return data[r * N + c]; }
+
+    // Lane access
+    Matrix<float, N, N> lane(int i) const {
+        Matrix<float, N, N> res(0.0f);
+        for (int e = 0; e < N * N; e++) res.data[e] = data[e][i];
+        return res;
+    }
+    void setLane(int i, const Matrix<float, N, N>& mat) {
+        for (int e = 0; e < N * N; e++) data[e].set(i, mat.data[e]);
+    }
+};
+
+typedef MatrixN<3, 4> Mat3fx4;
+typedef MatrixN<3, 8> Mat3fx8;
+typedef MatrixN<4, 4> Mat4fx4;
+typedef MatrixN<4, 8> Mat4fx8;
+
+/**
+ * @brief Solves W small systems A x = b at once, one per lane (e.g. per vertex quadric solves).
+ * Gaussian elimination where the partial pivoting is done per lane with selects, so every lane
+ * runs the same instructions. A lane is singular when a pivot is below N * epsilon * max|A| of
+ * that lane, the same tolerance as LUDecomposition.
+ * @return MaskN<W> lanes with a solution; x is undefined in the other lanes
+ */
+template<int N, int W>
+MaskN<W> solve(MatrixN<N, W> A, VectorN<N, W> b, VectorN<N, W>& x) {
+    FloatN<W> maxAbs(0.0f);
+    for (int e = 0; e < N * N; e++) maxAbs = max(maxAbs, abs(A.data[e]));
+    const FloatN<W> tolerance = maxAbs * (static_cast<float>(N) * std::numeric_limits<float>::epsilon());
+
+    MaskN<W> valid = FloatN<W>(0.0f) == FloatN<W>(0.0f);
+    for (int k = 0; k < N; k++) {
+        // Conditional swaps leave the largest |A(r, k)|, r >= k, of every lane in row k
+        for (int r = k + 1; r < N; r++) {
+            const MaskN<W> swap = abs(A(r, k)) > abs(A(k, k));
+            if (none(swap)) continue;
+            for (int c = k; c < N; c++) {
+                const FloatN<W> pivotRow = A(k, c);
+                A(k, c) = select(swap, A(r, c), pivotRow);
+                A(r, c) = select(swap, pivotRow, A(r, c));
+            }
+            const FloatN<W> pivotB = b.data[k];
+            b.data[k] = select(swap, b.data[r], pivotB);
+            b.data[r] = select(swap, pivotB, b.data[r]);
+        }
+        valid = valid & (abs(A(k, k)) > tolerance);
+
+        const FloatN<W> invPivot = 1.0f / A(k, k);
+        for (int r = k + 1; r < N; r++) {
+            const FloatN<W> factor = A(r, k) * invPivot;
+            for (int c = k + 1; c < N; c++) A(r, c) -= factor * A(k, c);
+            b.data[r] -= factor * b.data[k];
+        }
+    }
+
+    // Back substitution
+    for (int i = N - 1; i >= 0; i--) {
+        FloatN<W> sum = b.data[i];
+        for (int j = i + 1; j < N; j++) sum -= A(i, j) * x.data[j];
+        x.data[i] = sum / A(i, i);
+    }
+    return valid;
+}
+
+}
+}
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <initializer_list>
+#include <limits>
+#include <type_traits>
+
+namespace astro {
+namespace math {
+namespace cx {
+
+// ========================================================
+// --- CONSTEXPR SCALAR FUNCTIONS -------------------------
+// ========================================================
+// <cmath> is not constexpr before C++26. These functions call std:: at run time and
+// evaluate series in double precision in constant expressions, so lookup tables and fixed
+// matrices can be computed at compile time (see ConstexprMath in math_tests.cpp).
+// Compile time results are within a few double ulp of std::, float results round to the same value
+// except in rare ties.
+
+namespace detail {
+    constexpr double PI_D = 3.14159265358979323846;
+    constexpr double LN2_D = 0.693147180559945309417;
+
+    // Nearest integer of a value that fits in a long long
+    constexpr double roundNearest(double x) {
+        return static_cast<double>(static_cast<long long>(x + (x < 0.0 ? -0.5 : 0.5)));
+    }
+
+    // 2^k by repeated multiplication (exact, subnormals included)
+    constexpr double exp2i(int k) {
+        double res = 1.0;
+        for (; k > 0; --k) res *= 2.0;
+        for (; k < 0; ++k) res *= 0.5;
+        return res;
+    }
+
+    constexpr double abs(double x) { return (x < 0.0) ? -x : x; }
+
+    // c * c - x without the rounding error of the product (Dekker's exact product)
+    constexpr double squareResidual(double c, double x) {
+        const double split = 134217729.0 * c; // 2^27 + 1
+        const double hi = split - (split - c);
+        const double lo = c - hi;
+        const double p = c * c;
+        const double err = ((hi * hi - p) + 2.0 * hi * lo) + lo * lo;
+        return (p - x) + err;
+    }
+
+    constexpr double sqrt(double x) {
+        if (x < 0.0) return std::numeric_limits<double>::quiet_NaN();
+        if (x == 0.0 || x == std::numeric_limits<double>::infinity()) return x;
+        // Newton iterations decrease monotonically from any start above sqrt(x)
+        double r = (x > 1.0) ? x : 1.0;
+        while (true) {
+            const double next = 0.5 * (r + x / r);
+            if (next >= r) break;
+            r = next;
+        }
+        // Rounding can stop the iteration one ulp away, keep the neighbour with the smallest
+        // exact residual c * c - x
+        const unsigned long long bits = std::bit_cast<unsigned long long>(r);
+        double best = r, bestResidual = abs(squareResidual(r, x));
+        for (const double c : {std::bit_cast<double>(bits - 1), std::bit_cast<double>(bits + 1)}) {
+            const double residual = abs(squareResidual(c, x));
+            if (residual < bestResidual) { best = c; bestResidual = residual; }
+        }
+        return best;
+    }
+
+    // sin and cos of x in [-pi, pi] (Taylor series up to the last significant term)
+    constexpr double sinReduced(double x) {
+        double term = x, sum = x;
+        for (int n = 1; n < 30; ++n) {
+            term *= -x * x / ((2 * n) * (2 * n + 1));
+            sum += term;
+        }
+        return sum;
+    }
+    constexpr double cosReduced(double x) {
+        double term = 1.0, sum = 1.0;
+        for (int n = 1; n < 30; ++n) {
+            term *= -x * x / ((2 * n - 1) * (2 * n));
+            sum += term;
+        }
+        return sum;
+    }
+    constexpr double reduceAngle(double x) { return x - 2.0 * PI_D * roundNearest(x / (2.0 * PI_D)); }
+
+    constexpr double exp(double x) {
+        if (x != x) return x;
+        if (x > 709.8) return std::numeric_limits<double>::infinity();
+        if (x < -745.2) return 0.0;
+        // e^x = 2^k * e^r with |r| <= ln(2) / 2
+        const double k = roundNearest(x / LN2_D);
+        const double r = x - k * LN2_D;
+        double term = 1.0, sum = 1.0;
+        for (int n = 1; n < 25; ++n) {
+            term *= r / n;
+            sum += term;
+        }
+        // Split the scale so 2^k never overflows before the product
+        const int ki = static_cast<int>(k);
+        return sum * exp2i(ki / 2) * exp2i(ki - ki / 2);
+    }
+
+    constexpr double log(double x) {
+        if (x != x || x < 0.0) return std::numeric_limits<double>::quiet_NaN();
+        if (x == 0.0) return -std::numeric_limits<double>::infinity();
+        if (x == std::numeric_limits<double>::infinity()) return x;
+        // x = 2^e * m with m in [sqrt(1/2), sqrt(2)), then the atanh series in s = (m - 1) / (m + 1)
+        int e = 0;
+        while (x >= 1.4142135623730951) { x *= 0.5; ++e; }
+        while (x < 0.7071067811865476) { x *= 2.0; --e; }
+        const double s = (x - 1.0) / (x + 1.0);
+        double power = s, sum = s;
+        for (int n = 3; n < 40; n += 2) {
+            power *= s * s;
+            sum += power / n;
+        }
+        return e * LN2_D + 2.0 * sum;
+    }
+
+    constexpr double pow(double x, double y) {
+        if (y == 0.0) return 1.0;
+        const bool integerY = (y == roundNearest(y)) && (y > -1e18 && y < 1e18);
+        if (integerY) {
+            // Exponentiation by squaring: exact when the result is representable
+            long long n = static_cast<long long>(y < 0.0 ? -y : y);
+            double base = x, res = 1.0;
+            while (n) {
+                if (n & 1) res *= base;
+                base *= base;
+                n >>= 1;
+            }
+            return (y < 0.0) ? 1.0 / res : res;
+        }
+        if (x < 0.0) return std::numeric_limits<double>::quiet_NaN();
+        if (x == 0.0) return (y > 0.0) ? 0.0 : std::numeric_limits<double>::infinity();
+        return exp(y * log(x));
+    }
+}
+
+template<typename T> requires std::is_arithmetic_v<T>
+constexpr T abs(T x) noexcept { return (x < static_cast<T>(0)) ? -x : x; }
+
+template<std::floating_point T>
+constexpr T sqrt(T x) noexcept {
+    if (!std::is_constant_evaluated()) return std::sqrt(x);
+    return static_cast<T>(detail::sqrt(static_cast<double>(x)));
+}
+
+template<std::integral T>
+constexpr double sqrt(T x) noexcept { return sqrt(static_cast<double>(x)); } // Like std::sqrt
+
+template<std::floating_point T>
+constexpr T sin(T x) noexcept {
+    if (!std::is_constant_evaluated()) return std::sin(x);
+    return static_cast<T>(detail::sinReduced(detail::reduceAngle(static_cast<double>(x))));
+}
+
+template<std::floating_point T>
+constexpr T cos(T x) noexcept {
+    if (!std::is_constant_evaluated()) return std::cos(x);
+    return static_cast<T>(detail::cosReduced(detail::reduceAngle(static_cast<double>(x))));
+}
+
+template<std::floating_point T>
+constexpr T tan(T x) noexcept {
+    if (!std::is_constant_evaluated()) return std::tan(x);
+    const double r = detail::reduceAngle(static_cast<double>(x));
+    return static_cast<T>(detail::sinReduced(r) / detail::cosReduced(r));
+}
+
+template<std::floating_point T>
+constexpr T exp(T x) noexcept {
+    if (!std::is_constant_evaluated()) return std::exp(x);
+    return static_cast<T>(detail::exp(static_cast<double>(x)));
+}
+
+template<std::floating_point T>
+constexpr T log(T x) noexcept {
+    if (!std::is_constant_evaluated()) return std::log(x);
+    return static_cast<T>(detail::log(static_cast<double>(x)));
+}
+
+template<std::floating_point T>
+constexpr T pow(T x, T y) noexcept {
+    if (!std::is_constant_evaluated()) return std::pow(x, y);
+    return static_cast<T>(detail::pow(static_cast<double>(x), static_cast<double>(y)));
+}
+
+}
+}
+}
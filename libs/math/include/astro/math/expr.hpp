@@ -0,0 +1,158 @@
+#pragma once
+
+#include "astro/math/math.hpp"
+
+#include <type_traits>
+
+namespace astro {
+namespace math {
+namespace expr {
+
+// ========================================================
+// --- EXPRESSION TEMPLATES -------------------------------
+// ========================================================
+// Lazily evaluated vector arithmetic. An expression such as
+//     Vec3f r = (lazy(a) * alpha + lazy(b) * beta + lazy(c) * gamma) * w;
+// builds a small tree of references and scalars and is evaluated in a single loop when it
+// is converted to a Vector, without intermediate vectors.
+// Expressions reference their operands: convert them in the same statement, never keep
+// them in 'auto' variables.
+// Nodes are force inlined, otherwise unoptimized builds pay a call per element and node.
+#if defined(__GNUC__) || defined(__clang__)
+    #define ASTRO_EXPR_INLINE [[gnu::always_inline]] inline
+#elif defined(_MSC_VER)
+    #define ASTRO_EXPR_INLINE __forceinline
+#else
+    #define ASTRO_EXPR_INLINE inline
+#endif
+
+/**
+ * @brief CRTP base of every vector expression
+ */
+template<typename E>
+struct VecExpr {
+    ASTRO_EXPR_INLINE const E& self() const noexcept { return static_cast<const E&>(*this); }
+
+    /**
+     * @brief Evaluates the expression (fused loop)
+     */
+    template<typename T, int N>
+    ASTRO_EXPR_INLINE operator Vector<T, N>() const noexcept {
+        static_assert(N == E::size, "Expression and vector sizes do not match");
+        Vector<T, N> res;
+        for (int i = 0; i < N; i++) res.data[i] = static_cast<T>(self()[i]);
+        return res;
+    }
+};
+
+/**
+ * @brief Leaf: reference to an existing vector
+ */
+template<typename T, int N>
+struct Ref : VecExpr<Ref<T, N>> {
+    using value_type = T;
+    static constexpr int size = N;
+    const Vector<T, N>& v;
+
+    ASTRO_EXPR_INLINE explicit Ref(const Vector<T, N>& v) noexcept : v(v) {}
+    ASTRO_EXPR_INLINE T operator[](int i) const noexcept { return v.data[i]; }
+};
+
+/**
+ * @brief Element wise operation between two expressions
+ */
+template<typename L, typename R, typename Op>
+struct Binary : VecExpr<Binary<L, R, Op>> {
+    static_assert(L::size == R::size, "Expression sizes do not match");
+    using value_type = typename L::value_type;
+    static constexpr int size = L::size;
+    L l;
+    R r;
+
+    ASTRO_EXPR_INLINE Binary(const L& l, const R& r) noexcept : l(l), r(r) {}
+    ASTRO_EXPR_INLINE value_type operator[](int i) const noexcept { return Op::apply(l[i], r[i]); }
+};
+
+/**
+ * @brief Operation between an expression and a scalar
+ */
+template<typename L, typename Op>
+struct Scalar : VecExpr<Scalar<L, Op>> {
+    using value_type = typename L::value_type;
+    static constexpr int size = L::size;
+    L l;
+    value_type s;
+
+    ASTRO_EXPR_INLINE Scalar(const L& l, value_type s) noexcept : l(l), s(s) {}
+    ASTRO_EXPR_INLINE value_type operator[](int i) const noexcept { return Op::apply(l[i], s); }
+};
+
+struct Add { template<typename T> ASTRO_EXPR_INLINE static T apply(T a, T b) noexcept { return a + b; } };
+struct Sub { template<typename T> ASTRO_EXPR_INLINE static T apply(T a, T b) noexcept { return a - b; } };
+struct Mul { template<typename T> ASTRO_EXPR_INLINE static T apply(T a, T b) noexcept { return a * b; } };
+struct Div { template<typename T> ASTRO_EXPR_INLINE static T apply(T a, T b) noexcept { return a / b; } };
+
+/**
+ * @brief Starts a lazy expression from a vector
+ * @return Ref<T, N>
+ */
+template<typename T, int N>
+ASTRO_EXPR_INLINE Ref<T, N> lazy(const Vector<T, N>& v) noexcept { return Ref<T, N>(v); }
+
+// Vectors mixed with expressions are wrapped as leaves
+template<typename E>
+ASTRO_EXPR_INLINE const E& leaf(const VecExpr<E>& e) noexcept { return e.self(); }
+template<typename T, int N>
+ASTRO_EXPR_INLINE Ref<T, N> leaf(const Vector<T, N>& v) noexcept { return Ref<T, N>(v); }
+
+template<typename A>
+using Leaf = std::remove_cvref_t<decltype(leaf(std::declval<const A&>()))>;
+
+// At least one side must be an expression (Vector op Vector keeps the eager operators)
+template<typename A, typename B>
+concept ExprOperands = std::is_base_of_v<VecExpr<Leaf<A>>, Leaf<A>> && std::is_base_of_v<VecExpr<Leaf<B>>, Leaf<B>> &&
+                       (std::is_base_of_v<VecExpr<A>, A> || std::is_base_of_v<VecExpr<B>, B>);
+
+// Expression Operators
+template<typename A, typename B> requires ExprOperands<A, B>
+ASTRO_EXPR_INLINE Binary<Leaf<A>, Leaf<B>, Add> operator+(const A& a, const B& b) noexcept { return {leaf(a), leaf(b)}; }
+template<typename A, typename B> requires ExprOperands<A, B>
+ASTRO_EXPR_INLINE Binary<Leaf<A>, Leaf<B>, Sub> operator-(const A& a, const B& b) noexcept { return {leaf(a), leaf(b)}; }
+template<typename A, typename B> requires ExprOperands<A, B>
+ASTRO_EXPR_INLINE Binary<Leaf<A>, Leaf<B>, Mul> operator*(const A& a, const B& b) noexcept { return {leaf(a), leaf(b)}; }
+
+template<typename E>
+ASTRO_EXPR_INLINE Scalar<E, Add> operator+(const VecExpr<E>& a, typename E::value_type s) noexcept { return {a.self(), s}; }
+template<typename E>
+ASTRO_EXPR_INLINE Scalar<E, Sub> operator-(const VecExpr<E>& a, typename E::value_type s) noexcept { return {a.self(), s}; }
+template<typename E>
+ASTRO_EXPR_INLINE Scalar<E, Mul> operator*(const VecExpr<E>& a, typename E::value_type s) noexcept { return {a.self(), s}; }
+template<typename E>
+ASTRO_EXPR_INLINE Scalar<E, Mul> operator*(typename E::value_type s, const VecExpr<E>& a) noexcept { return {a.self(), s}; }
+template<typename E>
+ASTRO_EXPR_INLINE Scalar<E, Div> operator/(const VecExpr<E>& a, typename E::value_type s) noexcept { return {a.self(), s}; } // Unchecked
+
+/**
+ * @brief Evaluates an expression into a vector
+ * @return Vector<value_type, size>
+ */
+template<typename E>
+ASTRO_EXPR_INLINE Vector<typename E::value_type, E::size> eval(const VecExpr<E>& e) noexcept { return e; }
+
+/**
+ * @brief Dot product of two expressions (single loop, no temporaries)
+ */
+template<typename A, typename B>
+ASTRO_EXPR_INLINE typename Leaf<A>::value_type dot(const A& a, const B& b) noexcept requires ExprOperands<A, B> {
+    const Leaf<A> la = leaf(a);
+    const Leaf<B> lb = leaf(b);
+    typename Leaf<A>::value_type res = 0;
+    for (int i = 0; i < Leaf<A>::size; i++) res += la[i] * lb[i];
+    return res;
+}
+
+}
+}
+}
+
+#undef ASTRO_EXPR_INLINE
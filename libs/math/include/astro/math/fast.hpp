@@ -0,0 +1,123 @@
+#pragma once
+
+#include "astro/math/math.hpp"
+#include "astro/math/simd.hpp"
+
+#include <bit>
+#include <cstdint>
+#include <limits>
+
+namespace astro {
+namespace math {
+namespace fast {
+
+// ========================================================
+// --- FAST APPROXIMATIONS --------------------------------
+// ========================================================
+// Cheaper replacements for std::sqrt, std::pow and divisions in shading code. Every function
+// documents its domain and its maximum error (measured over the whole domain, see FastMath
+// in math_tests.cpp). Inputs outside the domain are not checked.
+
+/**
+ * @brief Approximate 1 / sqrt(x)
+ * Hardware estimate plus Newton-Raphson refinement (exact division without SSE/NEON).
+ * Max relative error: 4e-7. Domain: x > 0 (normal floats).
+ */
+inline float rsqrt(float x) noexcept {
+    return simd::first(simd::rsqrt(simd::splat(x)));
+}
+
+/**
+ * @brief Approximate 1 / x
+ * Hardware estimate plus Newton-Raphson refinement (exact division without SSE/NEON).
+ * Max relative error: 3e-7. Domain: x != 0, |x| < 2^126.
+ */
+inline float rcp(float x) noexcept {
+    return simd::first(simd::rcp(simd::splat(x)));
+}
+
+/**
+ * @brief Approximate sqrt(x) computed as x * rsqrt(x)
+ * Max relative error: 4e-7. Domain: x >= 0 (0 returns 0).
+ */
+inline float sqrt(float x) noexcept {
+    return (x > 0.0f) ? x * rsqrt(x) : 0.0f;
+}
+
+/**
+ * @brief Approximate base 2 logarithm
+ * The mantissa is reduced to [sqrt(1/2), sqrt(2)) and log2 is evaluated with the
+ * atanh series in s = (m - 1) / (m + 1) up to s^7 (Estrin scheme, short dependency chain).
+ * Max error: 3e-7 absolute for x in (1/2, 2), 2e-7 relative outside.
+ * Domain: x > 0 (normal floats), x <= 0 returns -infinity.
+ */
+inline float log2(float x) noexcept {
+    if (x <= 0.0f) return -std::numeric_limits<float>::infinity();
+    // Offsetting the bits by sqrt(1/2) splits x without branches
+    const int32_t bits = std::bit_cast<int32_t>(x);
+    const int32_t e = (bits - 0x3F3504F3) >> 23;
+    const float m = std::bit_cast<float>(bits - (e << 23)); // [sqrt(1/2), sqrt(2))
+
+    const float s = (m - 1.0f) / (m + 1.0f);
+    const float s2 = s * s;
+    const float s4 = s2 * s2;
+    // 2 / ln(2) * (s + s^3 / 3 + s^5 / 5 + s^7 / 7)
+    const float p = (2.88539008f + 0.961796694f * s2) + s4 * (0.577078016f + 0.412198583f * s2);
+    return static_cast<float>(e) + s * p;
+}
+
+/**
+ * @brief Approximate 2^x
+ * 2^x = 2^k * 2^f with k = round(x) and |f| <= 1/2, 2^f is a degree 6 Taylor polynomial
+ * (Estrin scheme).
+ * Max relative error: 4e-7. Domain: any x, results below 2^-126 flush to 0,
+ * x >= 127.5 returns +infinity.
+ */
+inline float exp2(float x) noexcept {
+    if (x < -126.0f) return 0.0f;
+    if (x >= 127.5f) return std::numeric_limits<float>::infinity();
+    // Adding 1.5 * 2^23 rounds to the nearest integer, which ends in the low mantissa bits
+    const float rounded = x + 12582912.0f;
+    const int32_t k = std::bit_cast<int32_t>(rounded) - 0x4B400000;
+    const float f = x - (rounded - 12582912.0f);
+
+    // ln(2)^n / n!
+    const float f2 = f * f;
+    const float f4 = f2 * f2;
+    const float p = (1.0f + 0.693147181f * f) + f2 * (0.240226507f + 0.0555041087f * f) +
+                    f4 * ((0.00961812911f + 0.00133335581f * f) + 0.000154035304f * f2);
+    return p * std::bit_cast<float>((k + 127) << 23);
+}
+
+/**
+ * @brief Approximate x^y computed as exp2(y * log2(x))
+ * The error of log2 is scaled by y, so the relative error grows with |y * log2(x)|:
+ * max 3e-5 for x in [1e-3, 1] and y in [1, 256] (specular exponents) with a normal result.
+ * Domain: x >= 0 (0 returns 0), y finite.
+ */
+inline float pow(float x, float y) noexcept {
+    if (x <= 0.0f) return 0.0f;
+    return exp2(y * log2(x));
+}
+
+/**
+ * @brief Normalizes a float vector with rsqrt (max relative error 5e-7 per component)
+ * The zero vector is not checked.
+ * @return Vector<float, N>
+ */
+template<int N>
+inline Vector<float, N> normalize(const Vector<float, N>& v) noexcept {
+    return v * rsqrt(dot(v, v));
+}
+
+/**
+ * @brief Length of a float vector (fast::sqrt of the squared length)
+ */
+template<int N>
+inline float len(const Vector<float, N>& v) noexcept {
+    return sqrt(dot(v, v));
+}
+
+}
+}
+}
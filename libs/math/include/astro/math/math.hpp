@@ -4,11 +4,35 @@
 #include <array>
 #include <cmath>
 #include <cstring>
+#include <functional>
 #include <initializer_list>
+#include <limits>
 #include <ostream>
 #include <stdexcept>
+#include <type_traits>
 #include <unistd.h>
 
+#include "astro/math/cx.hpp"
+#include "astro/math/simd.hpp"
+
+// Runtime checks (index ranges, division by zero, zero-length normalization).
+// On by default in debug builds and off with NDEBUG, define ASTRO_MATH_CHECKED as 0/1 to force it.
+// Unchecked accessors and operators are noexcept. at() is always checked.
+#ifndef ASTRO_MATH_CHECKED
+    #ifdef NDEBUG
+        #define ASTRO_MATH_CHECKED 0
+    #else
+        #define ASTRO_MATH_CHECKED 1
+    #endif
+#endif
+#if ASTRO_MATH_CHECKED
+    #define ASTRO_MATH_NOEXCEPT
+    #define ASTRO_MATH_CHECK(cond, exception, msg) do { if (!(cond)) throw exception(msg); } while (0)
+#else
+    #define ASTRO_MATH_NOEXCEPT noexcept
+    #define ASTRO_MATH_CHECK(cond, exception, msg) ((void)0)
+#endif
+
 namespace astro {
 namespace math {
     
@@ -29,10 +53,8 @@ struct Vector {
     constexpr Vector(const T& val){     // Scalar initialization
         std::fill(data, data+N, val);
     };
-    constexpr Vector(Vector<T, N>& vec){ // Copy-Constructor
-        for (int i = 0; i < N; i++) data[i] = vec[i];
-    }
-    Vector(const std::initializer_list<T> &list){ // List initialization
+    constexpr Vector(const Vector<T, N>& vec) = default; // Copy-Constructor
+    constexpr Vector(const std::initializer_list<T> &list){ // List initialization
         if(N != list.size()) 
             throw std::runtime_error("Mismatch initializer list and vector lengths");
         int i = 0;
@@ -42,21 +64,31 @@ struct Vector {
     }
 
     // Access operators
-    T& operator[](int i) { return data[i]; }
-    const T& operator[](int i) const { return data[i]; }
+    constexpr T& operator[](int i) noexcept { return data[i]; }
+    constexpr const T& operator[](int i) const noexcept { return data[i]; }
     
     // Other matrix-like access operators
-    T& operator()(int r, int c = 0) {
-        if (c != 0 || r < 0 || r >= N) throw std::out_of_range("Vector index out of bounds");
+    constexpr T& operator()(int r, int c = 0) ASTRO_MATH_NOEXCEPT {
+        ASTRO_MATH_CHECK(c == 0 && r >= 0 && r < N, std::out_of_range, "Vector index out of bounds");
         return data[r];
     }
-    const T& operator()(int r, int c = 0) const {
-        if (c != 0 || r < 0 || r >= N) throw std::out_of_range("Vector index out of bounds");
+    constexpr const T& operator()(int r, int c = 0) const ASTRO_MATH_NOEXCEPT {
+        ASTRO_MATH_CHECK(c == 0 && r >= 0 && r < N, std::out_of_range, "Vector index out of bounds");
         return data[r];
     }
+
+    // Checked access (always)
+    constexpr T& at(int i) {
+        if (i < 0 || i >= N) throw std::out_of_range("Vector index out of bounds");
+        return data[i];
+    }
+    constexpr const T& at(int i) const {
+        if (i < 0 || i >= N) throw std::out_of_range("Vector index out of bounds");
+        return data[i];
+    }
     
     // Assignment operators
-    Vector<T, N>& operator=(const T& val){
+    constexpr Vector<T, N>& operator=(const T& val){
         std::fill(data, data+N, val);
         return *this;
     }
@@ -73,11 +105,9 @@ template<typename T> struct Vector<T, 2> {
     };
     Vector() = default; // No initialization
     constexpr Vector(const T& val) : data(val, val) {} // Scalar fill
-    constexpr Vector(const Vector<T, rows>& vec){ // Copy-Constructor
-        for (int i = 0; i < rows; i++) data[i] = vec[i];
-    }
+    constexpr Vector(const Vector<T, rows>& vec) = default; // Copy-Constructor
     constexpr Vector(T x, T y): data(x, y) {};
-    Vector(const std::initializer_list<T> &list){ // List initialization
+    constexpr Vector(const std::initializer_list<T> &list){ // List initialization
         if(list.size() != rows) 
             throw std::runtime_error("Mismatch initializer list and vector lengths");
         int i = 0;
@@ -85,21 +115,31 @@ template<typename T> struct Vector<T, 2> {
     }
     
     // Access operators
-    T& operator[](int i) { return data[i]; }
-    const T& operator[](int i) const { return data[i]; }
+    constexpr T& operator[](int i) noexcept { return data[i]; }
+    constexpr const T& operator[](int i) const noexcept { return data[i]; }
 
     // Other matrix-like access operators
-    T& operator()(int r, int c = 0) {
-        if (c != 0 || r < 0 || r >= rows) throw std::out_of_range("Vector index out of bounds");
+    constexpr T& operator()(int r, int c = 0) ASTRO_MATH_NOEXCEPT {
+        ASTRO_MATH_CHECK(c == 0 && r >= 0 && r < rows, std::out_of_range, "Vector index out of bounds");
         return data[r];
     }
-    const T& operator()(int r, int c = 0) const {
-        if (c != 0 || r < 0 || r >= rows) throw std::out_of_range("Vector index out of bounds");
+    constexpr const T& operator()(int r, int c = 0) const ASTRO_MATH_NOEXCEPT {
+        ASTRO_MATH_CHECK(c == 0 && r >= 0 && r < rows, std::out_of_range, "Vector index out of bounds");
         return data[r];
     }
 
+    // Checked access (always)
+    constexpr T& at(int i) {
+        if (i < 0 || i >= rows) throw std::out_of_range("Vector index out of bounds");
+        return data[i];
+    }
+    constexpr const T& at(int i) const {
+        if (i < 0 || i >= rows) throw std::out_of_range("Vector index out of bounds");
+        return data[i];
+    }
+
     // Assignment operators
-    Vector<T, rows>& operator=(const T& val){
+    constexpr Vector<T, rows>& operator=(const T& val){
         std::fill(data, data+rows, val);
         return *this;
     }
@@ -117,12 +157,10 @@ template<typename T> struct Vector<T, 3> {
     };
     Vector() = default; // No initialization
     constexpr Vector(const T& val) : data(val, val, val) {} // Scalar fill
-    constexpr Vector(Vector<T, 2> vec, T z_val) : data{vec.x, vec.y, z_val} {} // From Vec2 + z
-    constexpr Vector(const Vector<T, rows>& vec){ // Copy-Constructor
-        for (int i = 0; i < rows; i++) data[i] = vec[i];
-    }
+    constexpr Vector(Vector<T, 2> vec, T z_val) : data{vec.data[0], vec.data[1], z_val} {} // From Vec2 + z
+    constexpr Vector(const Vector<T, rows>& vec) = default; // Copy-Constructor
     constexpr Vector(T x, T y, T z): data(x, y, z) {};
-    Vector(const std::initializer_list<T> &list){ // List initialization
+    constexpr Vector(const std::initializer_list<T> &list){ // List initialization
         if(list.size() != rows) 
             throw std::runtime_error("Mismatch initializer list and vector lengths");
         int i = 0;
@@ -130,21 +168,31 @@ template<typename T> struct Vector<T, 3> {
     }
     
     // Access operators
-    T& operator[](int i) { return data[i]; }
-    const T& operator[](int i) const { return data[i]; }
+    constexpr T& operator[](int i) noexcept { return data[i]; }
+    constexpr const T& operator[](int i) const noexcept { return data[i]; }
 
     // Other matrix-like access operators
-    T& operator()(int r, int c = 0) {
-        if (c != 0 || r < 0 || r >= rows) throw std::out_of_range("Vector index out of bounds");
+    constexpr T& operator()(int r, int c = 0) ASTRO_MATH_NOEXCEPT {
+        ASTRO_MATH_CHECK(c == 0 && r >= 0 && r < rows, std::out_of_range, "Vector index out of bounds");
         return data[r];
     }
-    const T& operator()(int r, int c = 0) const {
-        if (c != 0 || r < 0 || r >= rows) throw std::out_of_range("Vector index out of bounds");
+    constexpr const T& operator()(int r, int c = 0) const ASTRO_MATH_NOEXCEPT {
+        ASTRO_MATH_CHECK(c == 0 && r >= 0 && r < rows, std::out_of_range, "Vector index out of bounds");
         return data[r];
     }
 
+    // Checked access (always)
+    constexpr T& at(int i) {
+        if (i < 0 || i >= rows) throw std::out_of_range("Vector index out of bounds");
+        return data[i];
+    }
+    constexpr const T& at(int i) const {
+        if (i < 0 || i >= rows) throw std::out_of_range("Vector index out of bounds");
+        return data[i];
+    }
+
     // Assignment operators
-    Vector<T, rows>& operator=(const T& val){
+    constexpr Vector<T, rows>& operator=(const T& val){
         std::fill(data, data+rows, val);
         return *this;
     }
@@ -165,13 +213,11 @@ template<typename T> struct Vector<T, 4> {
     };
     Vector() = default; // No initialization
     constexpr Vector(const T& val) : data(val, val, val, val) {} // Scalar fill
-    constexpr Vector(Vector<T, 2> vec, T z_val, T w_val) : data{vec.x, vec.y, z_val, w_val} {} // From Vec2 + z + w
-    constexpr Vector(Vector<T, 3> vec, T w_val) : data{vec.x, vec.y, vec.z, w_val} {} // From Vec3 + w
-    constexpr Vector(const Vector<T, rows>& vec){ // Copy-Constructor
-        for (int i = 0; i < rows; i++) data[i] = vec[i];
-    }
+    constexpr Vector(Vector<T, 2> vec, T z_val, T w_val) : data{vec.data[0], vec.data[1], z_val, w_val} {} // From Vec2 + z + w
+    constexpr Vector(Vector<T, 3> vec, T w_val) : data{vec.data[0], vec.data[1], vec.data[2], w_val} {} // From Vec3 + w
+    constexpr Vector(const Vector<T, rows>& vec) = default; // Copy-Constructor
     constexpr Vector(T x, T y, T z, T w): data(x, y, z, w) {};
-    Vector(const std::initializer_list<T> &list){ // List initialization
+    constexpr Vector(const std::initializer_list<T> &list){ // List initialization
         if(list.size() != rows) 
             throw std::runtime_error("Mismatch initializer list and vector lengths");
         int i = 0;
@@ -179,26 +225,101 @@ template<typename T> struct Vector<T, 4> {
     }
     
     // Access operators
-    T& operator[](int i) { return data[i]; }
-    const T& operator[](int i) const { return data[i]; }
+    constexpr T& operator[](int i) noexcept { return data[i]; }
+    constexpr const T& operator[](int i) const noexcept { return data[i]; }
 
     // Other matrix-like access operators
-    T& operator()(int r, int c = 0) {
-        if (c != 0 || r < 0 || r >= rows) throw std::out_of_range("Vector index out of bounds");
+    constexpr T& operator()(int r, int c = 0) ASTRO_MATH_NOEXCEPT {
+        ASTRO_MATH_CHECK(c == 0 && r >= 0 && r < rows, std::out_of_range, "Vector index out of bounds");
         return data[r];
     }
-    const T& operator()(int r, int c = 0) const {
-        if (c != 0 || r < 0 || r >= rows) throw std::out_of_range("Vector index out of bounds");
+    constexpr const T& operator()(int r, int c = 0) const ASTRO_MATH_NOEXCEPT {
+        ASTRO_MATH_CHECK(c == 0 && r >= 0 && r < rows, std::out_of_range, "Vector index out of bounds");
         return data[r];
     }
 
+    // Checked access (always)
+    constexpr T& at(int i) {
+        if (i < 0 || i >= rows) throw std::out_of_range("Vector index out of bounds");
+        return data[i];
+    }
+    constexpr const T& at(int i) const {
+        if (i < 0 || i >= rows) throw std::out_of_range("Vector index out of bounds");
+        return data[i];
+    }
+
     // Assignment operators
-    Vector<T, rows>& operator=(const T& val){
+    constexpr Vector<T, rows>& operator=(const T& val){
         std::fill(data, data+rows, val);
         return *this;
     }
 };
 
+/**
+ * @brief Vec4f specialization. Same API as Vector<T, 4> but 16-byte aligned and
+ * backed by a SIMD register, so the Vec4f overloads below map to a few vector instructions.
+ */
+template<> struct alignas(16) Vector<float, 4> {
+    using value_type = float;
+    static constexpr int rows = 4;
+    static constexpr int cols = 1;
+
+    union {
+        float data[4]; 
+        struct { float x, y, z, w; };
+        struct { float r, g, b, a; };
+        Vector<float, 2> xy;
+        Vector<float, 3> xyz;
+        Vector<float, 3> rgb;
+        simd::f32x4 reg;
+    };
+    Vector() = default; // No initialization
+    constexpr Vector(const float& val) : data{val, val, val, val} {} // Scalar fill
+    constexpr Vector(Vector<float, 2> vec, float z_val, float w_val) : data{vec.data[0], vec.data[1], z_val, w_val} {} // From Vec2 + z + w
+    constexpr Vector(Vector<float, 3> vec, float w_val) : data{vec.data[0], vec.data[1], vec.data[2], w_val} {} // From Vec3 + w
+    constexpr Vector(const Vector<float, rows>& vec) = default; // Copy-Constructor
+    constexpr Vector(float x, float y, float z, float w): data{x, y, z, w} {};
+    explicit Vector(simd::f32x4 v) : reg(v) {} // From SIMD register
+    constexpr Vector(const std::initializer_list<float> &list){ // List initialization
+        if(list.size() != rows) 
+            throw std::runtime_error("Mismatch initializer list and vector lengths");
+        int i = 0;
+        for(auto it = list.begin(); it != list.end(); ++it, ++i){ data[i] = *it; }
+    }
+    
+    // Access operators
+    constexpr float& operator[](int i) noexcept { return data[i]; }
+    constexpr const float& operator[](int i) const noexcept { return data[i]; }
+
+    // Other matrix-like access operators
+    constexpr float& operator()(int r, int c = 0) ASTRO_MATH_NOEXCEPT {
+        ASTRO_MATH_CHECK(c == 0 && r >= 0 && r < rows, std::out_of_range, "Vector index out of bounds");
+        return data[r];
+    }
+    constexpr const float& operator()(int r, int c = 0) const ASTRO_MATH_NOEXCEPT {
+        ASTRO_MATH_CHECK(c == 0 && r >= 0 && r < rows, std::out_of_range, "Vector index out of bounds");
+        return data[r];
+    }
+
+    // Checked access (always)
+    constexpr float& at(int i) {
+        if (i < 0 || i >= rows) throw std::out_of_range("Vector index out of bounds");
+        return data[i];
+    }
+    constexpr const float& at(int i) const {
+        if (i < 0 || i >= rows) throw std::out_of_range("Vector index out of bounds");
+        return data[i];
+    }
+
+    // Assignment operators
+    constexpr Vector<float, rows>& operator=(const Vector<float, rows>& vec) = default;
+    constexpr Vector<float, rows>& operator=(const float& val){
+        if (std::is_constant_evaluated()) data[0] = data[1] = data[2] = data[3] = val;
+        else reg = simd::splat(val);
+        return *this;
+    }
+};
+
 // Common type definitions
 typedef Vector<float, 2> Vec2f;
 typedef Vector<float, 3> Vec3f;
@@ -224,7 +345,7 @@ std::ostream& operator<<(std::ostream& os, const Vector<T, N>& a) {
 }
 
 template<typename T, int N>
-bool operator==(const Vector<T, N>& a, const Vector<T, N>& b) {
+constexpr bool operator==(const Vector<T, N>& a, const Vector<T, N>& b) {
     bool equal = true; int i = 0;
     while(equal && i < N){
         equal = a.data[i] == b.data[i];
@@ -233,7 +354,7 @@ bool operator==(const Vector<T, N>& a, const Vector<T, N>& b) {
     return equal; 
 }
 template<typename T, int N>
-bool operator!=(const Vector<T, N>& a, const Vector<T, N>& b) {
+constexpr bool operator!=(const Vector<T, N>& a, const Vector<T, N>& b) {
     return !(a == b); 
 }
 
@@ -242,7 +363,7 @@ bool operator!=(const Vector<T, N>& a, const Vector<T, N>& b) {
  * @return Vector<T, N> difference vector
  */
 template<typename T, int N>
-Vector<T, N> operator+(const Vector<T, N>& a, const T val) {
+constexpr Vector<T, N> operator+(const Vector<T, N>& a, const T val) {
     Vector<T, N> res; 
     for(int i = 0; i < N; i++) res.data[i] = a.data[i] + val;
     return res; 
@@ -252,7 +373,7 @@ Vector<T, N> operator+(const Vector<T, N>& a, const T val) {
  * @return Vector<T, N> summed vector
  */
 template<typename T, int N>
-Vector<T, N> operator+(const Vector<T, N>& a, const Vector<T, N>& b) {
+constexpr Vector<T, N> operator+(const Vector<T, N>& a, const Vector<T, N>& b) {
     Vector<T, N> res; 
     for(int i = 0; i < N; i++) res.data[i] = a.data[i] + b.data[i];
     return res; 
@@ -263,7 +384,7 @@ Vector<T, N> operator+(const Vector<T, N>& a, const Vector<T, N>& b) {
  * @return Vector<T, N> difference vector
  */
 template<typename T, int N>
-Vector<T, N> operator-(const Vector<T, N>& a, const T val) {
+constexpr Vector<T, N> operator-(const Vector<T, N>& a, const T val) {
     return a + (-val); 
 }
 
@@ -272,7 +393,7 @@ Vector<T, N> operator-(const Vector<T, N>& a, const T val) {
  * @return Vector<T, N> difference vector
  */
 template<typename T, int N>
-Vector<T, N> operator-(const Vector<T, N>& a, const Vector<T, N>& b) {
+constexpr Vector<T, N> operator-(const Vector<T, N>& a, const Vector<T, N>& b) {
     Vector<T, N> res; 
     for(int i = 0; i < N; i++) res.data[i] = a.data[i] - b.data[i];
     return res; 
@@ -283,7 +404,7 @@ Vector<T, N> operator-(const Vector<T, N>& a, const Vector<T, N>& b) {
  * @return Vector<T, N> elm-product vector
  */
 template<typename T, int N>
-Vector<T, N> operator*(const Vector<T, N>& a, const T& val) {
+constexpr Vector<T, N> operator*(const Vector<T, N>& a, const T& val) {
     Vector<T, N> res; 
     for(int i = 0; i < N; i++) res.data[i] = a.data[i] * val;
     return res; 
@@ -293,7 +414,7 @@ Vector<T, N> operator*(const Vector<T, N>& a, const T& val) {
  * @return Vector<T, N> elm-product vector
  */
 template<typename T, int N>
-Vector<T, N> operator*(const Vector<T, N>& a, const Vector<T, N>& b) {
+constexpr Vector<T, N> operator*(const Vector<T, N>& a, const Vector<T, N>& b) {
     Vector<T, N> res; 
     for(int i = 0; i < N; i++) res.data[i] = a.data[i] * b.data[i];
     return res; 
@@ -304,8 +425,8 @@ Vector<T, N> operator*(const Vector<T, N>& a, const Vector<T, N>& b) {
  * @return Vector<T, N> elm-division vector
  */
 template<typename T, int N>
-Vector<T, N> operator/(const Vector<T, N>& a, const T& val) {
-    if(val == 0.0) throw std::runtime_error("Division by 0");
+constexpr Vector<T, N> operator/(const Vector<T, N>& a, const T& val) ASTRO_MATH_NOEXCEPT {
+    ASTRO_MATH_CHECK(val != 0.0, std::runtime_error, "Division by 0");
     Vector<T, N> res; 
     for(int i = 0; i < N; i++) {
         res.data[i] = a.data[i] / val;
@@ -318,10 +439,10 @@ Vector<T, N> operator/(const Vector<T, N>& a, const T& val) {
  * @return Vector<T, N> elm-division vector
  */
 template<typename T, int N>
-Vector<T, N> operator/(const Vector<T, N>& a, const Vector<T, N>& b) {
+constexpr Vector<T, N> operator/(const Vector<T, N>& a, const Vector<T, N>& b) ASTRO_MATH_NOEXCEPT {
     Vector<T, N> res; 
     for(int i = 0; i < N; i++) {
-        if(b.data[i] == 0.0) throw std::runtime_error("Division by 0");
+        ASTRO_MATH_CHECK(b.data[i] != 0.0, std::runtime_error, "Division by 0");
         res.data[i] = a.data[i] / b.data[i];
     }
     return res; 
@@ -332,20 +453,18 @@ Vector<T, N> operator/(const Vector<T, N>& a, const Vector<T, N>& b) {
  * @return T
  */
 template<typename T, int N>
-T dot(const Vector<T, N>& a, const Vector<T, N>& b) {
+constexpr T dot(const Vector<T, N>& a, const Vector<T, N>& b) {
     T res = static_cast<T>(0); // Initialize to 0
     for(int i = 0; i < N; i++) res += a.data[i] * b.data[i];
     return res; 
 }
 
 template<typename T, int N>
-Vector<T, N> cross(const Vector<T, N>& a, const Vector<T, N>& b) {
+constexpr Vector<T, N> cross(const Vector<T, N>& a, const Vector<T, N>& b) {
     static_assert(N == 3, "Cross product is only defined for 3D vectors.");
-    Vector<T, N> res;
-    res.x = a.y * b.z - a.z * b.y;
-    res.y = a.z * b.x - a.x * b.z;
-    res.z = a.x * b.y - a.y * b.x;
-    return res;
+    return Vector<T, N>(a.data[1] * b.data[2] - a.data[2] * b.data[1],
+                        a.data[2] * b.data[0] - a.data[0] * b.data[2],
+                        a.data[0] * b.data[1] - a.data[1] * b.data[0]);
 }
 
 /**
@@ -353,17 +472,17 @@ Vector<T, N> cross(const Vector<T, N>& a, const Vector<T, N>& b) {
  * @return int 
  */
 template<typename T, int N>
-int dim(Vector<T, N>){ return N; }
+constexpr int dim(Vector<T, N>){ return N; }
 
 /**
  * @brief Get the length (magnitude) of a vector
  * @return T 
  */
 template<typename T, int N>
-T len(Vector<T, N> vec){
+constexpr T len(const Vector<T, N>& vec) noexcept {
     T squareSum = 0;
     for(int i = 0; i < N; i++) squareSum += vec.data[i] * vec.data[i];
-    return std::sqrt(squareSum);
+    return cx::sqrt(squareSum);
 }
 
 /**
@@ -374,14 +493,89 @@ T len(Vector<T, N> vec){
  * @return Vector<T, N> 
  */
 template<typename T, int N>
-Vector<T, N> normalize(Vector<T, N> vec){
+constexpr Vector<T, N> normalize(const Vector<T, N>& vec) ASTRO_MATH_NOEXCEPT {
     T length = len(vec);
-    if(length == 0) throw std::runtime_error("Cannot normalize zero-length vector");
+    ASTRO_MATH_CHECK(length != 0, std::runtime_error, "Cannot normalize zero-length vector");
     Vector<T, N> res;
     for(int i = 0; i < N; i++) res.data[i] = vec.data[i] / length;
     return res;
 }
 
+// Vec4f overloads (SIMD). Exact matches, so they are preferred over the generic templates.
+// Constant expressions cannot use the intrinsics and take the scalar path instead
+namespace detail {
+    template<typename Op>
+    constexpr Vec4f lanewise(const Vec4f& a, const Vec4f& b, Op op) {
+        return Vec4f(op(a.data[0], b.data[0]), op(a.data[1], b.data[1]), op(a.data[2], b.data[2]), op(a.data[3], b.data[3]));
+    }
+}
+constexpr Vec4f operator+(const Vec4f& a, const float val) {
+    if (std::is_constant_evaluated()) return detail::lanewise(a, Vec4f(val), std::plus<float>());
+    return Vec4f(simd::add(a.reg, simd::splat(val)));
+}
+constexpr Vec4f operator+(const Vec4f& a, const Vec4f& b) {
+    if (std::is_constant_evaluated()) return detail::lanewise(a, b, std::plus<float>());
+    return Vec4f(simd::add(a.reg, b.reg));
+}
+constexpr Vec4f operator-(const Vec4f& a, const float val) {
+    if (std::is_constant_evaluated()) return detail::lanewise(a, Vec4f(val), std::minus<float>());
+    return Vec4f(simd::sub(a.reg, simd::splat(val)));
+}
+constexpr Vec4f operator-(const Vec4f& a, const Vec4f& b) {
+    if (std::is_constant_evaluated()) return detail::lanewise(a, b, std::minus<float>());
+    return Vec4f(simd::sub(a.reg, b.reg));
+}
+constexpr Vec4f operator*(const Vec4f& a, const float& val) {
+    if (std::is_constant_evaluated()) return detail::lanewise(a, Vec4f(val), std::multiplies<float>());
+    return Vec4f(simd::mul(a.reg, simd::splat(val)));
+}
+constexpr Vec4f operator*(const Vec4f& a, const Vec4f& b) {
+    if (std::is_constant_evaluated()) return detail::lanewise(a, b, std::multiplies<float>());
+    return Vec4f(simd::mul(a.reg, b.reg));
+}
+constexpr Vec4f operator/(const Vec4f& a, const float& val) ASTRO_MATH_NOEXCEPT {
+    ASTRO_MATH_CHECK(val != 0.0, std::runtime_error, "Division by 0");
+    if (std::is_constant_evaluated()) return detail::lanewise(a, Vec4f(val), std::divides<float>());
+    return Vec4f(simd::div(a.reg, simd::splat(val)));
+}
+constexpr Vec4f operator/(const Vec4f& a, const Vec4f& b) ASTRO_MATH_NOEXCEPT {
+    if (std::is_constant_evaluated()) {
+        ASTRO_MATH_CHECK(b.data[0] != 0.0f && b.data[1] != 0.0f && b.data[2] != 0.0f && b.data[3] != 0.0f, std::runtime_error, "Division by 0");
+        return detail::lanewise(a, b, std::divides<float>());
+    }
+    ASTRO_MATH_CHECK(!simd::anyZero(b.reg), std::runtime_error, "Division by 0");
+    return Vec4f(simd::div(a.reg, b.reg));
+}
+constexpr float dot(const Vec4f& a, const Vec4f& b) {
+    if (std::is_constant_evaluated()) return a.data[0] * b.data[0] + a.data[1] * b.data[1] + a.data[2] * b.data[2] + a.data[3] * b.data[3];
+    return simd::first(simd::hsum(simd::mul(a.reg, b.reg)));
+}
+constexpr float len(const Vec4f& vec) { return cx::sqrt(dot(vec, vec)); }
+constexpr Vec4f normalize(const Vec4f& vec) ASTRO_MATH_NOEXCEPT {
+    if (std::is_constant_evaluated()) {
+        const float length = len(vec);
+        ASTRO_MATH_CHECK(length != 0, std::runtime_error, "Cannot normalize zero-length vector");
+        return vec / length;
+    }
+    const simd::f32x4 sqLen = simd::hsum(simd::mul(vec.reg, vec.reg));
+    ASTRO_MATH_CHECK(simd::first(sqLen) != 0, std::runtime_error, "Cannot normalize zero-length vector");
+    return Vec4f(simd::div(vec.reg, simd::sqrt(sqLen)));
+}
+
+/**
+ * @brief Cross product of the xyz parts (w of the result is 0 when both w are finite)
+ * @return Vec4f
+ */
+constexpr Vec4f cross(const Vec4f& a, const Vec4f& b) {
+    if (std::is_constant_evaluated()) {
+        return Vec4f(a.data[1] * b.data[2] - a.data[2] * b.data[1], a.data[2] * b.data[0] - a.data[0] * b.data[2],
+                     a.data[0] * b.data[1] - a.data[1] * b.data[0], a.data[3] * b.data[3] - a.data[3] * b.data[3]);
+    }
+    // a x b = (a * b.yzx - a.yzx * b).yzx
+    const simd::f32x4 c = simd::sub(simd::mul(a.reg, simd::yzx(b.reg)), simd::mul(simd::yzx(a.reg), b.reg));
+    return Vec4f(simd::yzx(c));
+}
+
 
 // ========================================================
 // --- MATRIX ---------------------------------------------
@@ -395,22 +589,18 @@ struct Matrix {
     static constexpr int cols = M;
 
     // Helper function to calculate the 1D index from 2D coordinates (row-major order)
-    constexpr int index(int r, int c) const {
-        if (r < 0 || r >= N || c < 0 || c >= M) {
-            throw std::out_of_range("Matrix index out of bounds.");
-        }
+    constexpr int index(int r, int c) const ASTRO_MATH_NOEXCEPT {
+        ASTRO_MATH_CHECK(r >= 0 && r < N && c >= 0 && c < M, std::out_of_range, "Matrix index out of bounds.");
         return r * M + c;
     }
     
-    Matrix() = delete;
+    Matrix() = default; // No initialization
     // Uniform Initialization Constructor
-    explicit Matrix(const T& val) {
+    constexpr explicit Matrix(const T& val) {
             std::fill(data.begin(), data.end(), val);
     }
-    Matrix(const Matrix<T, rows, cols>& mat){ // Copy-Constructor
-        std::memcpy(this->data.data(), mat.data.data(), rows*cols);
-    }
-    Matrix(const std::initializer_list<T> &list){ // List initialization
+    constexpr Matrix(const Matrix& mat) = default; // Copy-Constructor
+    constexpr Matrix(const std::initializer_list<T> &list){ // List initialization
         if(N*M != list.size()) 
             throw std::runtime_error("Mismatch initializer list and vector lengths");
         int i = 0;
@@ -419,7 +609,7 @@ struct Matrix {
         }
     }
     // Copy from a C-style 2D array
-    Matrix(const T (&matrix)[N][M]) {
+    constexpr Matrix(const T (&matrix)[N][M]) {
         for(int r = 0; r < N; ++r) {
             for(int c = 0; c < M; ++c) {
                 data[index(r, c)] = matrix[r][c];
@@ -428,15 +618,25 @@ struct Matrix {
     }
     
     // Access operator: Matrix[i][j]
-    T& operator()(int r, int c) {
+    constexpr T& operator()(int r, int c) ASTRO_MATH_NOEXCEPT {
         return data[index(r, c)];
     }
-    const T& operator()(int r, int c) const {
+    constexpr const T& operator()(int r, int c) const ASTRO_MATH_NOEXCEPT {
         return data[index(r, c)];
     }
 
+    // Checked access (always)
+    constexpr T& at(int r, int c) {
+        if (r < 0 || r >= rows || c < 0 || c >= cols) throw std::out_of_range("Matrix index out of bounds.");
+        return data[r * cols + c];
+    }
+    constexpr const T& at(int r, int c) const {
+        if (r < 0 || r >= rows || c < 0 || c >= cols) throw std::out_of_range("Matrix index out of bounds.");
+        return data[r * cols + c];
+    }
+
     // Static identity matrix creation
-    static Matrix<T, N, M> Identity(const T& diag_val = static_cast<T>(1)) {
+    static constexpr Matrix<T, N, M> Identity(const T& diag_val = static_cast<T>(1)) {
         static_assert(N == M, "Identity matrix must be square");
         Matrix<T, N, M> res(static_cast<T>(0));
         for (int i = 0; i < N; ++i)
@@ -447,6 +647,78 @@ struct Matrix {
 
 };
 
+/**
+ * @brief Mat4f specialization. Same API as Matrix<T, N, M>, rows are 16-byte aligned
+ * so they can be loaded straight into SIMD registers.
+ */
+template<>
+struct Matrix<float, 4, 4> {
+    alignas(16) std::array<float, 16> data; 
+    using value_type = float;
+    static constexpr int rows = 4;
+    static constexpr int cols = 4;
+
+    // Helper function to calculate the 1D index from 2D coordinates (row-major order)
+    constexpr int index(int r, int c) const ASTRO_MATH_NOEXCEPT {
+        ASTRO_MATH_CHECK(r >= 0 && r < rows && c >= 0 && c < cols, std::out_of_range, "Matrix index out of bounds.");
+        return r * cols + c;
+    }
+    
+    Matrix() = default; // No initialization
+    // Uniform Initialization Constructor
+    constexpr explicit Matrix(const float& val) {
+            std::fill(data.begin(), data.end(), val);
+    }
+    constexpr Matrix(const Matrix<float, rows, cols>& mat) = default; // Copy-Constructor
+    constexpr Matrix(const std::initializer_list<float> &list){ // List initialization
+        if(rows*cols != list.size()) 
+            throw std::runtime_error("Mismatch initializer list and vector lengths");
+        int i = 0;
+        for(auto it = list.begin(); it != list.end(); ++it, ++i){
+            data[i] = *it;
+        }
+    }
+    // Copy from a C-style 2D array
+    constexpr Matrix(const float (&matrix)[rows][cols]) {
+        for(int r = 0; r < rows; ++r) {
+            for(int c = 0; c < cols; ++c) {
+                data[index(r, c)] = matrix[r][c];
+            }
+        }
+    }
+    constexpr Matrix<float, rows, cols>& operator=(const Matrix<float, rows, cols>& mat) = default;
+    
+    // Access operator: Matrix[i][j]
+    constexpr float& operator()(int r, int c) ASTRO_MATH_NOEXCEPT {
+        return data[index(r, c)];
+    }
+    constexpr const float& operator()(int r, int c) const ASTRO_MATH_NOEXCEPT {
+        return data[index(r, c)];
+    }
+
+    // Checked access (always)
+    constexpr float& at(int r, int c) {
+        if (r < 0 || r >= rows || c < 0 || c >= cols) throw std::out_of_range("Matrix index out of bounds.");
+        return data[r * cols + c];
+    }
+    constexpr const float& at(int r, int c) const {
+        if (r < 0 || r >= rows || c < 0 || c >= cols) throw std::out_of_range("Matrix index out of bounds.");
+        return data[r * cols + c];
+    }
+
+    // SIMD row access (unchecked)
+    simd::f32x4 row(int r) const { return simd::load(&data[r * cols]); }
+    void setRow(int r, simd::f32x4 v) { simd::store(&data[r * cols], v); }
+
+    // Static identity matrix creation
+    static constexpr Matrix<float, rows, cols> Identity(const float& diag_val = 1.0f) {
+        Matrix<float, rows, cols> res(0.0f);
+        for (int i = 0; i < rows; ++i)
+            res(i, i) = diag_val;
+        return res;
+    }
+};
+
 typedef Matrix<float, 3, 3> Mat3f;
 typedef Matrix<float, 4, 4> Mat4f;
 
@@ -458,10 +730,8 @@ struct Matrix_View {
     static constexpr int cols = M;
 
     // Helper function to calculate the 1D index from 2D coordinates (row-major order)
-    constexpr int index(int r, int c) const {
-        if (r < 0 || r >= N || c < 0 || c >= M) {
-            throw std::out_of_range("Matrix index out of bounds.");
-        }
+    constexpr int index(int r, int c) const ASTRO_MATH_NOEXCEPT {
+        ASTRO_MATH_CHECK(r >= 0 && r < N && c >= 0 && c < M, std::out_of_range, "Matrix index out of bounds.");
         return r * M + c;
     }
 
@@ -478,12 +748,22 @@ struct Matrix_View {
     explicit Matrix_View(Matrix<T, N, M>& other) : data(other.data.data()) {}
 
     // Access operators
-    T& operator()(int r, int c) {
+    constexpr T& operator()(int r, int c) ASTRO_MATH_NOEXCEPT {
         return data[index(r, c)];
     }
-    const T& operator()(int r, int c) const {
+    constexpr const T& operator()(int r, int c) const ASTRO_MATH_NOEXCEPT {
         return data[index(r, c)];
     }
+
+    // Checked access (always)
+    constexpr T& at(int r, int c) {
+        if (r < 0 || r >= rows || c < 0 || c >= cols) throw std::out_of_range("Matrix index out of bounds.");
+        return data[r * cols + c];
+    }
+    constexpr const T& at(int r, int c) const {
+        if (r < 0 || r >= rows || c < 0 || c >= cols) throw std::out_of_range("Matrix index out of bounds.");
+        return data[r * cols + c];
+    }
     
 };
 
@@ -515,7 +795,7 @@ std::ostream& operator<<(std::ostream& os, const Mat& A) {
 }
 template <MatrixLike MatA, MatrixLike MatB>
 requires (MatA::rows == MatB::rows && MatA::cols == MatB::cols)
-bool operator==(const MatA& A, const MatB& B) {
+constexpr bool operator==(const MatA& A, const MatB& B) {
     for (int r = 0; r < MatA::rows; ++r)
         for (int c = 0; c < MatA::cols; ++c)
             if (A(r, c) != B(r, c))
@@ -524,14 +804,14 @@ bool operator==(const MatA& A, const MatB& B) {
 }
 template <MatrixLike MatA, MatrixLike MatB>
 requires (MatA::rows == MatB::rows && MatA::cols == MatB::cols)
-bool operator!=(const MatA& A, const MatB& B) {
+constexpr bool operator!=(const MatA& A, const MatB& B) {
     return !(A == B);
 }
 
 // Matrix * Matrix
 template <MatrixLike MatA, MatrixLike MatB>
 requires (MatA::cols == MatB::rows)
-Matrix<typename MatA::value_type, MatA::rows, MatB::cols>
+constexpr Matrix<typename MatA::value_type, MatA::rows, MatB::cols>
 operator*(const MatA& A, const MatB& B) {
     using T = typename MatA::value_type;
     Matrix<T, MatA::rows, MatB::cols> res(static_cast<T>(0));
@@ -551,7 +831,7 @@ operator*(const MatA& A, const MatB& B) {
 // Matrix * Vector
 template <MatrixLike MatA, typename T, int N>
 requires (MatA::cols == N)
-Vector<T, MatA::rows> operator*(const MatA& A, const Vector<T, N>& v) {
+constexpr Vector<T, MatA::rows> operator*(const MatA& A, const Vector<T, N>& v) {
     Vector<T, MatA::rows> res(static_cast<T>(0));
     for (int i = 0; i < MatA::rows; ++i)
         for (int j = 0; j < MatA::cols; ++j)
@@ -562,7 +842,7 @@ Vector<T, MatA::rows> operator*(const MatA& A, const Vector<T, N>& v) {
 // Vector * Matrix
 template <typename T, int N, MatrixLike MatB>
 requires (MatB::rows == N)
-Vector<T, MatB::cols> operator*(const Vector<T, N>& v, const MatB& B) {
+constexpr Vector<T, MatB::cols> operator*(const Vector<T, N>& v, const MatB& B) {
     Vector<T, MatB::cols> res(static_cast<T>(0));
     for (int j = 0; j < MatB::cols; ++j)
         for (int k = 0; k < MatB::rows; ++k)
@@ -582,7 +862,7 @@ Vector<T, 4> operator*(const Vector<T, 4>& v, const MatB& B) {
 
 // Transpose Matrix
 template <MatrixLike Mat>
-Mat transpose(const Mat& m){
+constexpr Matrix<typename Mat::value_type, Mat::cols, Mat::rows> transpose(const Mat& m){
     using T = typename Mat::value_type;
     Matrix<T, Mat::cols, Mat::rows> res(static_cast<T>(0));
 
@@ -593,10 +873,162 @@ Mat transpose(const Mat& m){
     return res;
 }
 
+// LU Decomposition
+/**
+ * @brief LU decomposition with partial pivoting: P * A = L * U.
+ * L (unit diagonal, not stored) and U share the 'lu' matrix, row i of P * A is row perm[i] of A.
+ * Works for any size, it backs determinant() and inverse() beyond 4x4 and the solve() functions.
+ */
+template<typename T, int N>
+struct LUDecomposition {
+    Matrix<T, N, N> lu;
+    std::array<int, N> perm;
+    int sign = 1;           // Parity of the permutation, (-1)^swaps
+    bool singular = false;  // A pivot was below N * epsilon * max|A|
+
+    template<MatrixLike Mat>
+    requires (Mat::rows == N && Mat::cols == N)
+    constexpr explicit LUDecomposition(const Mat& A) : lu(static_cast<T>(0)) {
+        T maxAbs = static_cast<T>(0);
+        for (int r = 0; r < N; ++r) {
+            perm[r] = r;
+            for (int c = 0; c < N; ++c) {
+                lu(r, c) = A(r, c);
+                maxAbs = std::max(maxAbs, static_cast<T>(cx::abs(A(r, c))));
+            }
+        }
+        const T tolerance = static_cast<T>(N) * std::numeric_limits<T>::epsilon() * maxAbs;
+
+        for (int k = 0; k < N; ++k) {
+            // Pivot: largest magnitude in column k
+            int pivot = k;
+            for (int r = k + 1; r < N; ++r)
+                if (cx::abs(lu(r, k)) > cx::abs(lu(pivot, k))) pivot = r;
+            if (pivot != k) {
+                for (int c = 0; c < N; ++c) std::swap(lu(k, c), lu(pivot, c));
+                std::swap(perm[k], perm[pivot]);
+                sign = -sign;
+            }
+            if (cx::abs(lu(k, k)) <= tolerance) { singular = true; continue; }
+
+            // Eliminate below the pivot, the multipliers are L
+            const T invPivot = static_cast<T>(1) / lu(k, k);
+            for (int r = k + 1; r < N; ++r) {
+                const T factor = lu(r, k) * invPivot;
+                lu(r, k) = factor;
+                for (int c = k + 1; c < N; ++c) lu(r, c) -= factor * lu(k, c);
+            }
+        }
+    }
+};
+
+/**
+ * @brief LU decomposition of a square matrix
+ * @return LUDecomposition<T, N>
+ */
+template<MatrixLike Mat>
+requires (Mat::rows == Mat::cols)
+constexpr LUDecomposition<typename Mat::value_type, Mat::rows> luDecompose(const Mat& A) {
+    return LUDecomposition<typename Mat::value_type, Mat::rows>(A);
+}
+
+/**
+ * @brief Determinant from the decomposition (0 if singular)
+ */
+template<typename T, int N>
+constexpr T determinant(const LUDecomposition<T, N>& dec) {
+    if (dec.singular) return static_cast<T>(0);
+    T det = static_cast<T>(dec.sign);
+    for (int i = 0; i < N; ++i) det *= dec.lu(i, i);
+    return det;
+}
+
+/**
+ * @brief Solves A * X = B for K right hand sides with a decomposition of A
+ * @throws std::runtime_error if A is singular
+ * @return Matrix<T, N, K>
+ */
+template<typename T, int N, int K>
+constexpr Matrix<T, N, K> solve(const LUDecomposition<T, N>& dec, const Matrix<T, N, K>& B) {
+    if (dec.singular) throw std::runtime_error("Matrix is singular");
+    Matrix<T, N, K> X(static_cast<T>(0));
+    for (int k = 0; k < K; ++k) {
+        // Forward substitution (L y = P b), then back substitution (U x = y)
+        for (int i = 0; i < N; ++i) {
+            T sum = B(dec.perm[i], k);
+            for (int j = 0; j < i; ++j) sum -= dec.lu(i, j) * X(j, k);
+            X(i, k) = sum;
+        }
+        for (int i = N - 1; i >= 0; --i) {
+            T sum = X(i, k);
+            for (int j = i + 1; j < N; ++j) sum -= dec.lu(i, j) * X(j, k);
+            X(i, k) = sum / dec.lu(i, i);
+        }
+    }
+    return X;
+}
+
+/**
+ * @brief Solves A * x = b with a decomposition of A
+ * @throws std::runtime_error if A is singular
+ * @return Vector<T, N>
+ */
+template<typename T, int N>
+constexpr Vector<T, N> solve(const LUDecomposition<T, N>& dec, const Vector<T, N>& b) {
+    Matrix<T, N, 1> B(static_cast<T>(0));
+    for (int i = 0; i < N; ++i) B(i, 0) = b[i];
+    const Matrix<T, N, 1> X = solve(dec, B);
+    Vector<T, N> x;
+    for (int i = 0; i < N; ++i) x[i] = X(i, 0);
+    return x;
+}
+
+/**
+ * @brief Solves the square system A * x = b (decompose once and reuse it for several b)
+ * @throws std::runtime_error if A is singular
+ * @return Vector<T, N>
+ */
+template<MatrixLike Mat, typename T, int N>
+requires (Mat::rows == Mat::cols && Mat::rows == N)
+constexpr Vector<T, N> solve(const Mat& A, const Vector<T, N>& b) {
+    return solve(luDecompose(A), b);
+}
+
+/**
+ * @brief Least squares solution of an overdetermined system (rows >= cols): minimizes |A * x - b|
+ * through the normal equations (A^T A) x = A^T b. Fine for well conditioned fitting problems.
+ * @throws std::runtime_error if A does not have full column rank
+ * @return Vector<T, cols>
+ */
+template<MatrixLike Mat, typename T, int N>
+requires (Mat::rows == N && Mat::rows >= Mat::cols)
+constexpr Vector<T, Mat::cols> solveLeastSquares(const Mat& A, const Vector<T, N>& b) {
+    constexpr int M = Mat::cols;
+    Matrix<T, M, M> AtA(static_cast<T>(0));
+    Vector<T, M> Atb(static_cast<T>(0));
+    for (int r = 0; r < N; ++r) {
+        for (int i = 0; i < M; ++i) {
+            Atb[i] += A(r, i) * b[r];
+            for (int j = 0; j < M; ++j) AtA(i, j) += A(r, i) * A(r, j);
+        }
+    }
+    return solve(luDecompose(AtA), Atb);
+}
+
+/**
+ * @brief Inverse from the decomposition (solves against the identity)
+ * @throws std::runtime_error if the matrix is singular
+ * @return Matrix<T, N, N>
+ */
+template<typename T, int N>
+constexpr Matrix<T, N, N> inverse(const LUDecomposition<T, N>& dec) {
+    return solve(dec, Matrix<T, N, N>::Identity());
+}
+
 // Determinant of a Matrix
 template <MatrixLike Mat>
-requires (Mat::rows == Mat::cols && Mat::rows <= 4)
-typename Mat::value_type 
+requires (Mat::rows == Mat::cols)
+constexpr typename Mat::value_type 
 determinant(const Mat& m) {
     using T = typename Mat::value_type;
     constexpr int N = Mat::rows;
@@ -628,14 +1060,14 @@ determinant(const Mat& m) {
         return (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
     } 
 
-    // Recursive determinant fallback is not recomended. LU decomposition needs to be implemented.
-    return 0;
+    // Larger matrices: product of the LU pivots, O(N^3) instead of a recursive expansion
+    return determinant(luDecompose(m));
 }
 
 // Minor of a Matrix (Returns the determinant of a (N-1)x(N-1) submatrix)
 template <MatrixLike Mat>
 requires (Mat::rows == Mat::cols)
-typename Mat::value_type 
+constexpr typename Mat::value_type 
 minor(const Mat& m, int row, int col) {
     using T = typename Mat::value_type;
     constexpr int N = Mat::rows;
@@ -658,12 +1090,14 @@ minor(const Mat& m, int row, int col) {
 // Inverse Matrix
 template <MatrixLike Mat>
 requires (Mat::rows == Mat::cols)
-Mat inverse(const Mat& A) {
+constexpr Mat inverse(const Mat& A) {
     using T = typename Mat::value_type;
+    if constexpr (Mat::rows > 4) return inverse(luDecompose(A)); // Cofactors would need (N-1)x(N-1) determinants
+
     T det = determinant(A);
     
     // This is a naive check. Singular matrices should be handled in a better way
-    if (std::abs(det) < 1e-9) throw std::runtime_error("Matrix is singular");
+    if (cx::abs(det) < 1e-9) throw std::runtime_error("Matrix is singular");
 
     Mat res(static_cast<T>(0));
     for (int r = 0; r < Mat::rows; ++r) {
@@ -677,6 +1111,145 @@ Mat inverse(const Mat& A) {
 }
 
 
+// Mat4f overloads (SIMD)
+constexpr Vec4f operator*(const Mat4f& A, const Vec4f& v) {
+    if (std::is_constant_evaluated()) {
+        Vec4f res(0.0f);
+        for (int i = 0; i < 4; ++i)
+            for (int j = 0; j < 4; ++j) res.data[i] += A.data[i * 4 + j] * v.data[j];
+        return res;
+    }
+    simd::f32x4 r0 = simd::mul(A.row(0), v.reg);
+    simd::f32x4 r1 = simd::mul(A.row(1), v.reg);
+    simd::f32x4 r2 = simd::mul(A.row(2), v.reg);
+    simd::f32x4 r3 = simd::mul(A.row(3), v.reg);
+    simd::transpose(r0, r1, r2, r3); // Lane i of rN holds the N-th product of row i
+    return Vec4f(simd::add(simd::add(r0, r1), simd::add(r2, r3)));
+}
+constexpr Mat4f operator*(const Mat4f& A, const Mat4f& B) {
+    if (std::is_constant_evaluated()) {
+        Mat4f res(0.0f);
+        for (int i = 0; i < 4; ++i)
+            for (int k = 0; k < 4; ++k)
+                for (int j = 0; j < 4; ++j) res.data[i * 4 + j] += A.data[i * 4 + k] * B.data[k * 4 + j];
+        return res;
+    }
+    const simd::f32x4 b0 = B.row(0), b1 = B.row(1), b2 = B.row(2), b3 = B.row(3);
+    Mat4f res(0.0f);
+    for (int i = 0; i < 4; ++i) {
+        // Row i of the result is a linear combination of the rows of B
+        simd::f32x4 acc = simd::mul(simd::splat(A.data[i * 4 + 0]), b0);
+        acc = simd::madd(simd::splat(A.data[i * 4 + 1]), b1, acc);
+        acc = simd::madd(simd::splat(A.data[i * 4 + 2]), b2, acc);
+        acc = simd::madd(simd::splat(A.data[i * 4 + 3]), b3, acc);
+        res.setRow(i, acc);
+    }
+    return res;
+}
+constexpr Mat4f transpose(const Mat4f& m) {
+    if (std::is_constant_evaluated()) {
+        Mat4f res(0.0f);
+        for (int r = 0; r < 4; ++r)
+            for (int c = 0; c < 4; ++c) res.data[c * 4 + r] = m.data[r * 4 + c];
+        return res;
+    }
+    simd::f32x4 r0 = m.row(0), r1 = m.row(1), r2 = m.row(2), r3 = m.row(3);
+    simd::transpose(r0, r1, r2, r3);
+    Mat4f res(0.0f);
+    res.setRow(0, r0); res.setRow(1, r1); res.setRow(2, r2); res.setRow(3, r3);
+    return res;
+}
+
+// Projection and view matrices (right handed, OpenGL clip space: z in [-1, 1] after the division)
+/**
+ * @brief Perspective projection
+ * @param fovY vertical field of view in radians
+ * @param aspect width / height
+ * @return Mat4f
+ */
+constexpr Mat4f perspective(float fovY, float aspect, float znear, float zfar) {
+    const float f = 1.0f / cx::tan(fovY / 2.0f);
+    Mat4f proj(0.0f);
+    proj(0, 0) = f / aspect;
+    proj(1, 1) = f;
+    proj(2, 2) = (zfar + znear) / (znear - zfar);
+    proj(2, 3) = (2.0f * zfar * znear) / (znear - zfar);
+    proj(3, 2) = -1.0f;
+    return proj;
+}
+
+/**
+ * @brief Orthographic projection of the box [left, right] x [bottom, top] x [-znear, -zfar]
+ * @return Mat4f
+ */
+constexpr Mat4f orthographic(float left, float right, float bottom, float top, float znear, float zfar) {
+    Mat4f proj = Mat4f::Identity();
+    proj(0, 0) = 2.0f / (right - left);
+    proj(1, 1) = 2.0f / (top - bottom);
+    proj(2, 2) = -2.0f / (zfar - znear);
+    proj(0, 3) = -(right + left) / (right - left);
+    proj(1, 3) = -(top + bottom) / (top - bottom);
+    proj(2, 3) = -(zfar + znear) / (zfar - znear);
+    return proj;
+}
+
+/**
+ * @brief View matrix of a camera at 'eye' looking at 'target' (rigid, see TransformType)
+ * @return Mat4f
+ */
+constexpr Mat4f lookAt(const Vec3f& eye, const Vec3f& target, const Vec3f& up) {
+    const Vec3f zaxis = normalize(eye - target);         // Forward
+    const Vec3f xaxis = normalize(cross(up, zaxis));     // Right
+    const Vec3f yaxis = cross(zaxis, xaxis);             // Up
+
+    Mat4f view = Mat4f::Identity();
+    const Vec3f* axes[3] = {&xaxis, &yaxis, &zaxis};
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 3; ++c) view(r, c) = axes[r]->data[c];
+        view(r, 3) = -dot(*axes[r], eye);
+    }
+    return view;
+}
+
+// Transform inverses
+/**
+ * @brief Structure of a 4x4 transform, lets callers pick a cheaper inverse.
+ * Ordered from the least to the most restrictive.
+ */
+enum class TransformType {
+    General,    // Any invertible matrix (projective)
+    Affine,     // Last row is (0, 0, 0, 1): linear part + translation
+    Rigid       // Orthonormal rotation + translation (no scale/shear)
+};
+
+/**
+ * @brief Inverse of an affine transform (the last row is assumed to be 0 0 0 1)
+ * @param m 
+ * @return Mat4f 
+ */
+Mat4f inverseAffine(const Mat4f& m);
+
+/**
+ * @brief Inverse of a rigid transform: the transposed rotation and the rotated, negated translation
+ * @param m 
+ * @return Mat4f 
+ */
+Mat4f inverseRigid(const Mat4f& m) noexcept;
+
+/**
+ * @brief Inverse transpose of the upper 3x3 block (normal matrix), without computing the full inverse
+ * @param m 
+ * @return Mat3f 
+ */
+Mat3f inverseTranspose3x3(const Mat4f& m);
+
+/**
+ * @brief Inverse using the cheapest routine valid for the declared transform type
+ * @param m 
+ * @param type 
+ * @return Mat4f 
+ */
+Mat4f inverse(const Mat4f& m, TransformType type);
 
 }
 }
\ No newline at end of file
@@ -0,0 +1,171 @@
+#pragma once
+
+// ========================================================
+// --- SIMD -----------------------------------------------
+// ========================================================
+// Thin wrapper over 4-wide float registers used by the Vec4f and Mat4f specializations.
+// SSE2 (x86-64 baseline) or NEON (AArch64 baseline) are selected at compile time,
+// a plain struct is used as fallback so the math library stays portable.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ASTRO_MATH_SSE
+    #include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #define ASTRO_MATH_NEON
+    #include <arm_neon.h>
+#else
+    #define ASTRO_MATH_SCALAR
+    #include <cmath>
+#endif
+
+namespace astro {
+namespace math {
+namespace simd {
+
+#if defined(ASTRO_MATH_SSE)
+    using f32x4 = __m128;
+
+    inline f32x4 load(const float* p) { return _mm_load_ps(p); }     // 16-byte aligned
+    inline void store(float* p, f32x4 a) { _mm_store_ps(p, a); }     // 16-byte aligned
+    inline f32x4 loadu(const float* p) { return _mm_loadu_ps(p); }
+    inline void storeu(float* p, f32x4 a) { _mm_storeu_ps(p, a); }
+    inline f32x4 splat(float v) { return _mm_set1_ps(v); }
+    inline f32x4 set(float x, float y, float z, float w) { return _mm_setr_ps(x, y, z, w); }
+    inline f32x4 add(f32x4 a, f32x4 b) { return _mm_add_ps(a, b); }
+    inline f32x4 sub(f32x4 a, f32x4 b) { return _mm_sub_ps(a, b); }
+    inline f32x4 mul(f32x4 a, f32x4 b) { return _mm_mul_ps(a, b); }
+    inline f32x4 div(f32x4 a, f32x4 b) { return _mm_div_ps(a, b); }
+    inline f32x4 madd(f32x4 a, f32x4 b, f32x4 c) { // a * b + c
+    #if defined(__FMA__)
+        return _mm_fmadd_ps(a, b, c);
+    #else
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+    #endif
+    }
+    inline f32x4 min(f32x4 a, f32x4 b) { return _mm_min_ps(a, b); }
+    inline f32x4 max(f32x4 a, f32x4 b) { return _mm_max_ps(a, b); }
+    inline f32x4 sqrt(f32x4 a) { return _mm_sqrt_ps(a); }
+
+    // 1/sqrt(a) and 1/a: hardware estimate (12 bits) refined with one Newton-Raphson step
+    inline f32x4 rsqrt(f32x4 a) {
+        const f32x4 y = _mm_rsqrt_ps(a);
+        const f32x4 ayy = _mm_mul_ps(_mm_mul_ps(a, y), y);
+        return _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), y), _mm_sub_ps(_mm_set1_ps(3.0f), ayy));
+    }
+    inline f32x4 rcp(f32x4 a) {
+        const f32x4 y = _mm_rcp_ps(a);
+        return _mm_mul_ps(y, _mm_sub_ps(_mm_set1_ps(2.0f), _mm_mul_ps(a, y)));
+    }
+
+    // Horizontal sum broadcast to every lane
+    inline f32x4 hsum(f32x4 a) {
+        f32x4 shuf = _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)); // [y, x, w, z]
+        f32x4 sums = _mm_add_ps(a, shuf);                             // [x+y, x+y, z+w, z+w]
+        shuf = _mm_shuffle_ps(sums, sums, _MM_SHUFFLE(1, 0, 3, 2));   // [z+w, z+w, x+y, x+y]
+        return _mm_add_ps(sums, shuf);
+    }
+    inline float first(f32x4 a) { return _mm_cvtss_f32(a); }
+    inline bool anyZero(f32x4 a) { return _mm_movemask_ps(_mm_cmpeq_ps(a, _mm_setzero_ps())) != 0; }
+
+    // a.yzx (used by cross products)
+    inline f32x4 yzx(f32x4 a) { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1)); }
+
+    inline void transpose(f32x4& r0, f32x4& r1, f32x4& r2, f32x4& r3) { _MM_TRANSPOSE4_PS(r0, r1, r2, r3); }
+
+    // [a[i0], a[i1], a[i2], a[i3]]
+    template<int i0, int i1, int i2, int i3>
+    inline f32x4 shuffle(f32x4 a) { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(i3, i2, i1, i0)); }
+
+#elif defined(ASTRO_MATH_NEON)
+    using f32x4 = float32x4_t;
+
+    inline f32x4 load(const float* p) { return vld1q_f32(p); }
+    inline void store(float* p, f32x4 a) { vst1q_f32(p, a); }
+    inline f32x4 loadu(const float* p) { return vld1q_f32(p); }
+    inline void storeu(float* p, f32x4 a) { vst1q_f32(p, a); }
+    inline f32x4 splat(float v) { return vdupq_n_f32(v); }
+    inline f32x4 set(float x, float y, float z, float w) { const float v[4] = {x, y, z, w}; return vld1q_f32(v); }
+    inline f32x4 add(f32x4 a, f32x4 b) { return vaddq_f32(a, b); }
+    inline f32x4 sub(f32x4 a, f32x4 b) { return vsubq_f32(a, b); }
+    inline f32x4 mul(f32x4 a, f32x4 b) { return vmulq_f32(a, b); }
+    inline f32x4 div(f32x4 a, f32x4 b) { return vdivq_f32(a, b); }
+    inline f32x4 madd(f32x4 a, f32x4 b, f32x4 c) { return vfmaq_f32(c, a, b); }
+    inline f32x4 min(f32x4 a, f32x4 b) { return vminq_f32(a, b); }
+    inline f32x4 max(f32x4 a, f32x4 b) { return vmaxq_f32(a, b); }
+    inline f32x4 sqrt(f32x4 a) { return vsqrtq_f32(a); }
+    // Estimates are 8 bits on NEON: two Newton-Raphson steps
+    inline f32x4 rsqrt(f32x4 a) {
+        f32x4 y = vrsqrteq_f32(a);
+        y = vmulq_f32(y, vrsqrtsq_f32(vmulq_f32(a, y), y));
+        return vmulq_f32(y, vrsqrtsq_f32(vmulq_f32(a, y), y));
+    }
+    inline f32x4 rcp(f32x4 a) {
+        f32x4 y = vrecpeq_f32(a);
+        y = vmulq_f32(y, vrecpsq_f32(a, y));
+        return vmulq_f32(y, vrecpsq_f32(a, y));
+    }
+    inline f32x4 hsum(f32x4 a) { return vdupq_n_f32(vaddvq_f32(a)); }
+    inline float first(f32x4 a) { return vgetq_lane_f32(a, 0); }
+    inline bool anyZero(f32x4 a) { return vmaxvq_u32(vceqzq_f32(a)) != 0; }
+    inline f32x4 yzx(f32x4 a) {
+        float32x4_t r = vextq_f32(a, a, 1);     // [y, z, w, x]
+        r = vcopyq_laneq_f32(r, 2, a, 0);       // [y, z, x, x]
+        return vcopyq_laneq_f32(r, 3, a, 3);    // [y, z, x, w]
+    }
+    inline void transpose(f32x4& r0, f32x4& r1, f32x4& r2, f32x4& r3) {
+        const float32x4x2_t t01 = vtrnq_f32(r0, r1);
+        const float32x4x2_t t23 = vtrnq_f32(r2, r3);
+        r0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+        r1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+        r2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+        r3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+    }
+    template<int i0, int i1, int i2, int i3>
+    inline f32x4 shuffle(f32x4 a) { return __builtin_shufflevector(a, a, i0, i1, i2, i3); }
+
+#else
+    struct f32x4 { float v[4]; };
+
+    inline f32x4 load(const float* p) { return {p[0], p[1], p[2], p[3]}; }
+    inline void store(float* p, f32x4 a) { for (int i = 0; i < 4; i++) p[i] = a.v[i]; }
+    inline f32x4 loadu(const float* p) { return load(p); }
+    inline void storeu(float* p, f32x4 a) { store(p, a); }
+    inline f32x4 splat(float v) { return {v, v, v, v}; }
+    inline f32x4 set(float x, float y, float z, float w) { return {x, y, z, w}; }
+    inline f32x4 add(f32x4 a, f32x4 b) { return {a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]}; }
+    inline f32x4 sub(f32x4 a, f32x4 b) { return {a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]}; }
+    inline f32x4 mul(f32x4 a, f32x4 b) { return {a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]}; }
+    inline f32x4 div(f32x4 a, f32x4 b) { return {a.v[0] / b.v[0], a.v[1] / b.v[1], a.v[2] / b.v[2], a.v[3] / b.v[3]}; }
+    inline f32x4 madd(f32x4 a, f32x4 b, f32x4 c) { return add(mul(a, b), c); }
+    inline f32x4 min(f32x4 a, f32x4 b) {
+        return {a.v[0] < b.v[0] ? a.v[0] : b.v[0], a.v[1] < b.v[1] ? a.v[1] : b.v[1],
+                a.v[2] < b.v[2] ? a.v[2] : b.v[2], a.v[3] < b.v[3] ? a.v[3] : b.v[3]};
+    }
+    inline f32x4 max(f32x4 a, f32x4 b) {
+        return {a.v[0] > b.v[0] ? a.v[0] : b.v[0], a.v[1] > b.v[1] ? a.v[1] : b.v[1],
+                a.v[2] > b.v[2] ? a.v[2] : b.v[2], a.v[3] > b.v[3] ? a.v[3] : b.v[3]};
+    }
+    inline f32x4 sqrt(f32x4 a) { return {std::sqrt(a.v[0]), std::sqrt(a.v[1]), std::sqrt(a.v[2]), std::sqrt(a.v[3])}; }
+    inline f32x4 rsqrt(f32x4 a) { return div(splat(1.0f), sqrt(a)); } // No estimate instructions: exact
+    inline f32x4 rcp(f32x4 a) { return div(splat(1.0f), a); }
+    inline f32x4 hsum(f32x4 a) { return splat(a.v[0] + a.v[1] + a.v[2] + a.v[3]); }
+    inline float first(f32x4 a) { return a.v[0]; }
+    inline bool anyZero(f32x4 a) { return a.v[0] == 0.0f || a.v[1] == 0.0f || a.v[2] == 0.0f || a.v[3] == 0.0f; }
+    inline f32x4 yzx(f32x4 a) { return {a.v[1], a.v[2], a.v[0], a.v[3]}; }
+    inline void transpose(f32x4& r0, f32x4& r1, f32x4& r2, f32x4& r3) {
+        const f32x4 c0 = {r0.v[0], r1.v[0], r2.v[0], r3.v[0]};
+        const f32x4 c1 = {r0.v[1], r1.v[1], r2.v[1], r3.v[1]};
+        const f32x4 c2 = {r0.v[2], r1.v[2], r2.v[2], r3.v[2]};
+        const f32x4 c3 = {r0.v[3], r1.v[3], r2.v[3], r3.v[3]};
+        r0 = c0; r1 = c1; r2 = c2; r3 = c3;
+    }
+    template<int i0, int i1, int i2, int i3>
+    inline f32x4 shuffle(f32x4 a) { return {a.v[i0], a.v[i1], a.v[i2], a.v[i3]}; }
+#endif
+
+    // Lane i broadcast to every lane
+    template<int i>
+    inline f32x4 broadcast(f32x4 a) { return shuffle<i, i, i, i>(a); }
+
+}
+}
+}
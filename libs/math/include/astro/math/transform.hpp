@@ -0,0 +1,202 @@
+#pragma once
+
+#include "astro/math/math.hpp"
+#include "astro/math/simd.hpp"
+
+#include <optional>
+
+namespace astro {
+namespace math {
+
+// ========================================================
+// --- QUATERNION -----------------------------------------
+// ========================================================
+/**
+ * @brief Rotation quaternion stored as a Vec4f (x, y, z vector part, w scalar part),
+ * so products, rotations and interpolation map to SIMD operations.
+ */
+struct Quatf {
+    Vec4f v;
+
+    Quatf() = default; // No initialization
+    Quatf(float x, float y, float z, float w) : v(x, y, z, w) {}
+    explicit Quatf(const Vec4f& v) : v(v) {}
+
+    static Quatf Identity() { return Quatf(0.0f, 0.0f, 0.0f, 1.0f); }
+
+    /**
+     * @brief Rotation of 'radians' around a normalized axis (right handed)
+     * @return Quatf
+     */
+    static Quatf fromAxisAngle(const Vec3f& axis, float radians);
+
+    /**
+     * @brief Rotation that maps the canonical axes to an orthonormal basis (the matrix columns)
+     * @return Quatf
+     */
+    static Quatf fromBasis(const Vec3f& x, const Vec3f& y, const Vec3f& z);
+};
+
+/**
+ * @brief Hamilton product: rotates by b first, then by a
+ * @return Quatf
+ */
+inline Quatf operator*(const Quatf& a, const Quatf& b) {
+    using namespace simd;
+    // r = a.w * b + a.x * [ b.w, -b.z,  b.y, -b.x]
+    //             + a.y * [ b.z,  b.w, -b.x, -b.y]
+    //             + a.z * [-b.y,  b.x,  b.w, -b.z]
+    f32x4 r = mul(broadcast<3>(a.v.reg), b.v.reg);
+    r = madd(broadcast<0>(a.v.reg), mul(shuffle<3, 2, 1, 0>(b.v.reg), set(1.0f, -1.0f, 1.0f, -1.0f)), r);
+    r = madd(broadcast<1>(a.v.reg), mul(shuffle<2, 3, 0, 1>(b.v.reg), set(1.0f, 1.0f, -1.0f, -1.0f)), r);
+    r = madd(broadcast<2>(a.v.reg), mul(shuffle<1, 0, 3, 2>(b.v.reg), set(-1.0f, 1.0f, 1.0f, -1.0f)), r);
+    return Quatf(Vec4f(r));
+}
+
+inline float dot(const Quatf& a, const Quatf& b) { return dot(a.v, b.v); }
+inline Quatf conjugate(const Quatf& q) { return Quatf(Vec4f(simd::mul(q.v.reg, simd::set(-1.0f, -1.0f, -1.0f, 1.0f)))); }
+inline Quatf normalize(const Quatf& q) ASTRO_MATH_NOEXCEPT { return Quatf(normalize(q.v)); }
+
+/**
+ * @brief Inverse rotation. Unit quaternions (every rotation built by this library) can use conjugate()
+ * @return Quatf
+ */
+inline Quatf inverse(const Quatf& q) ASTRO_MATH_NOEXCEPT { return Quatf(conjugate(q).v / dot(q, q)); }
+
+/**
+ * @brief Rotates a vector by a unit quaternion (xyz, the w lane is kept)
+ * v' = v + w * t + u x t with t = 2 * (u x v)
+ * @return Vec4f
+ */
+inline Vec4f rotate(const Quatf& q, const Vec4f& v) {
+    const Vec4f t = cross(q.v, v) * 2.0f;
+    const Vec4f r = v + cross(q.v, t);
+    return Vec4f(simd::madd(simd::broadcast<3>(q.v.reg), t.reg, r.reg));
+}
+inline Vec3f rotate(const Quatf& q, const Vec3f& v) { return rotate(q, Vec4f(v, 0.0f)).xyz; }
+
+/**
+ * @brief Normalized linear interpolation (shortest path). Cheaper than slerp, the angular speed is not constant
+ * @return Quatf
+ */
+inline Quatf nlerp(const Quatf& a, const Quatf& b, float t) {
+    const Vec4f end = (dot(a, b) < 0.0f) ? b.v * -1.0f : b.v;
+    return Quatf(normalize(a.v + (end - a.v) * t));
+}
+
+/**
+ * @brief Spherical linear interpolation (shortest path, constant angular speed)
+ * @return Quatf
+ */
+Quatf slerp(const Quatf& a, const Quatf& b, float t);
+
+/**
+ * @brief Rotation matrix of a unit quaternion
+ * @return Mat3f
+ */
+Mat3f toMat3f(const Quatf& q);
+
+
+// ========================================================
+// --- TRANSFORM (TRS) ------------------------------------
+// ========================================================
+/**
+ * @brief Translation, rotation and scale: p' = T + R * (S * p).
+ * Composition, inversion and interpolation work on the components with SIMD operations;
+ * the Mat4f is only built (and cached) when matrix() is called.
+ * Composing or inverting rotations with non-uniform scales would produce shear, which
+ * TRS cannot represent: those results are exact for uniform scales only.
+ */
+class Transform {
+public:
+    Transform() : translation(0.0f), rotation(Quatf::Identity()), scale(1.0f, 1.0f, 1.0f, 1.0f) {}
+    Transform(const Vec3f& translation, const Quatf& rotation = Quatf::Identity(), const Vec3f& scale = Vec3f(1.0f))
+        : translation(translation, 0.0f), rotation(rotation), scale(scale, 1.0f) {}
+
+    // Getters
+    Vec3f getTranslation() const { return translation.xyz; }
+    const Quatf& getRotation() const { return rotation; }
+    Vec3f getScale() const { return scale.xyz; }
+
+    // Setters (invalidate the cached matrix)
+    void setTranslation(const Vec3f& t) { translation = Vec4f(t, 0.0f); cachedMatrix.reset(); }
+    void setRotation(const Quatf& r) { rotation = r; cachedMatrix.reset(); }
+    void setScale(const Vec3f& s) { scale = Vec4f(s, 1.0f); cachedMatrix.reset(); }
+
+    /**
+     * @brief Matrix of the transform, built on first use after a change
+     * @return const Mat4f&
+     */
+    const Mat4f& matrix() const {
+        if (!cachedMatrix) cachedMatrix = toMat4f();
+        return *cachedMatrix;
+    }
+
+    /**
+     * @brief Builds the matrix (without touching the cache)
+     * @return Mat4f
+     */
+    Mat4f toMat4f() const;
+
+    /**
+     * @brief Rigid when there is no scale, Affine otherwise (see inverse(const Mat4f&, TransformType))
+     * @return TransformType
+     */
+    TransformType type() const {
+        return (scale.x == 1.0f && scale.y == 1.0f && scale.z == 1.0f) ? TransformType::Rigid : TransformType::Affine;
+    }
+
+    Vec3f transformPoint(const Vec3f& p) const { return (translation + rotate(rotation, scale * Vec4f(p, 0.0f))).xyz; }
+    Vec3f transformDir(const Vec3f& d) const { return rotate(rotation, scale * Vec4f(d, 0.0f)).xyz; }
+
+    friend Transform operator*(const Transform& parent, const Transform& child);
+    friend Transform inverse(const Transform& t) ASTRO_MATH_NOEXCEPT;
+    friend Transform interpolate(const Transform& a, const Transform& b, float t);
+
+private:
+    Vec4f translation; // w = 0
+    Quatf rotation;
+    Vec4f scale;       // w = 1
+
+    mutable std::optional<Mat4f> cachedMatrix; // Built by matrix()
+};
+
+/**
+ * @brief Composition: applies child first, then parent (same order as parent.matrix() * child.matrix())
+ * @return Transform
+ */
+inline Transform operator*(const Transform& parent, const Transform& child) {
+    Transform res;
+    res.translation = parent.translation + rotate(parent.rotation, parent.scale * child.translation);
+    res.rotation = parent.rotation * child.rotation;
+    res.scale = parent.scale * child.scale;
+    return res;
+}
+
+/**
+ * @brief Inverse transform: reciprocal scale, conjugated rotation and the translation mapped back
+ * @return Transform
+ */
+inline Transform inverse(const Transform& t) ASTRO_MATH_NOEXCEPT {
+    ASTRO_MATH_CHECK(t.scale.x != 0.0f && t.scale.y != 0.0f && t.scale.z != 0.0f, std::domain_error, "Transform has a zero scale");
+    Transform res;
+    res.scale = Vec4f(simd::div(simd::splat(1.0f), t.scale.reg));
+    res.rotation = conjugate(t.rotation);
+    res.translation = res.scale * rotate(res.rotation, t.translation) * -1.0f;
+    return res;
+}
+
+/**
+ * @brief Interpolates two transforms (lerp of translation and scale, slerp of rotation)
+ * @return Transform
+ */
+inline Transform interpolate(const Transform& a, const Transform& b, float t) {
+    Transform res;
+    res.translation = a.translation + (b.translation - a.translation) * t;
+    res.rotation = slerp(a.rotation, b.rotation, t);
+    res.scale = a.scale + (b.scale - a.scale) * t;
+    return res;
+}
+
+}
+}
@@ -8,17 +8,6 @@ namespace math {
 // ========================================================
 // --- MATRIX ---------------------------------------------
 // ========================================================
-// Matrix * Vector specializations
-template <>
-Vec4f operator*(const Mat4f& A, const Vec4f& v) {
-    return Vec4f(
-        A(0,0)*v[0] + A(0,1)*v[1] + A(0,2)*v[2] + A(0,3)*v[3],
-        A(1,0)*v[0] + A(1,1)*v[1] + A(1,2)*v[2] + A(1,3)*v[3],
-        A(2,0)*v[0] + A(2,1)*v[1] + A(2,2)*v[2] + A(2,3)*v[3],
-        A(3,0)*v[0] + A(3,1)*v[1] + A(3,2)*v[2] + A(3,3)*v[3]
-    );
-}
-
 // Matrix inverse specializations
 template <>
 inline Mat3f inverse(const Mat3f& m) {
@@ -88,5 +77,75 @@ inline Mat4f inverse(const Mat4f& m) {
     return res;
 }
 
+// Transform inverses
+Mat4f inverseAffine(const Mat4f& m) {
+    // Inverse of the linear part (adjugate / determinant)
+    const float c00 = m(1,1) * m(2,2) - m(1,2) * m(2,1);
+    const float c01 = m(1,2) * m(2,0) - m(1,0) * m(2,2);
+    const float c02 = m(1,0) * m(2,1) - m(1,1) * m(2,0);
+    const float det = m(0,0) * c00 + m(0,1) * c01 + m(0,2) * c02;
+
+    // This is a naive check. Singular matrices should be handled in a better way
+    if (std::abs(det) < 1e-9) throw std::runtime_error("Matrix is singular");
+    const float invDet = 1.0f / det;
+
+    Mat4f res(0.0f);
+    res(0,0) = c00 * invDet;
+    res(1,0) = c01 * invDet;
+    res(2,0) = c02 * invDet;
+    res(0,1) = (m(0,2) * m(2,1) - m(0,1) * m(2,2)) * invDet;
+    res(1,1) = (m(0,0) * m(2,2) - m(0,2) * m(2,0)) * invDet;
+    res(2,1) = (m(0,1) * m(2,0) - m(0,0) * m(2,1)) * invDet;
+    res(0,2) = (m(0,1) * m(1,2) - m(0,2) * m(1,1)) * invDet;
+    res(1,2) = (m(0,2) * m(1,0) - m(0,0) * m(1,2)) * invDet;
+    res(2,2) = (m(0,0) * m(1,1) - m(0,1) * m(1,0)) * invDet;
+
+    // Translation: -A^-1 * t
+    for (int r = 0; r < 3; ++r)
+        res(r,3) = -(res(r,0) * m(0,3) + res(r,1) * m(1,3) + res(r,2) * m(2,3));
+    res(3,3) = 1.0f;
+    return res;
+}
+
+Mat4f inverseRigid(const Mat4f& m) noexcept {
+    Mat4f res(0.0f);
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 3; ++c) res.data[r * 4 + c] = m.data[c * 4 + r]; // R^T
+        res.data[r * 4 + 3] = -(m.data[0 * 4 + r] * m.data[3] + m.data[1 * 4 + r] * m.data[7] + m.data[2 * 4 + r] * m.data[11]); // -R^T * t
+    }
+    res.data[15] = 1.0f;
+    return res;
+}
+
+Mat3f inverseTranspose3x3(const Mat4f& m) {
+    // (A^-1)^T = cofactor(A) / det(A)
+    Mat3f res(0.0f);
+    res(0,0) = m(1,1) * m(2,2) - m(1,2) * m(2,1);
+    res(0,1) = m(1,2) * m(2,0) - m(1,0) * m(2,2);
+    res(0,2) = m(1,0) * m(2,1) - m(1,1) * m(2,0);
+    const float det = m(0,0) * res(0,0) + m(0,1) * res(0,1) + m(0,2) * res(0,2);
+
+    // This is a naive check. Singular matrices should be handled in a better way
+    if (std::abs(det) < 1e-9) throw std::runtime_error("Matrix is singular");
+    const float invDet = 1.0f / det;
+
+    res(0,0) *= invDet; res(0,1) *= invDet; res(0,2) *= invDet;
+    res(1,0) = (m(0,2) * m(2,1) - m(0,1) * m(2,2)) * invDet;
+    res(1,1) = (m(0,0) * m(2,2) - m(0,2) * m(2,0)) * invDet;
+    res(1,2) = (m(0,1) * m(2,0) - m(0,0) * m(2,1)) * invDet;
+    res(2,0) = (m(0,1) * m(1,2) - m(0,2) * m(1,1)) * invDet;
+    res(2,1) = (m(0,2) * m(1,0) - m(0,0) * m(1,2)) * invDet;
+    res(2,2) = (m(0,0) * m(1,1) - m(0,1) * m(1,0)) * invDet;
+    return res;
+}
+
+Mat4f inverse(const Mat4f& m, TransformType type) {
+    switch (type) {
+        case TransformType::Rigid:  return inverseRigid(m);
+        case TransformType::Affine: return inverseAffine(m);
+        default:                    return inverse(m);
+    }
+}
+
+}
 }
-}
\ No newline at end of file
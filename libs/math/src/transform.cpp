@@ -0,0 +1,84 @@
+
+#include "astro/math/transform.hpp"
+
+#include <cmath>
+
+namespace astro {
+namespace math {
+
+// ========================================================
+// --- QUATERNION -----------------------------------------
+// ========================================================
+Quatf Quatf::fromAxisAngle(const Vec3f& axis, float radians) {
+    const float s = std::sin(radians * 0.5f);
+    return Quatf(axis.x * s, axis.y * s, axis.z * s, std::cos(radians * 0.5f));
+}
+
+Quatf Quatf::fromBasis(const Vec3f& x, const Vec3f& y, const Vec3f& z) {
+    // m(r, c) is the component r of the basis vector c. The largest of w, x, y, z is
+    // computed from the diagonal first to keep the divisions stable
+    const float m00 = x.x, m10 = x.y, m20 = x.z;
+    const float m01 = y.x, m11 = y.y, m21 = y.z;
+    const float m02 = z.x, m12 = z.y, m22 = z.z;
+    const float trace = m00 + m11 + m22;
+    if (trace > 0.0f) {
+        const float s = 2.0f * std::sqrt(trace + 1.0f); // 4w
+        return Quatf((m21 - m12) / s, (m02 - m20) / s, (m10 - m01) / s, 0.25f * s);
+    }
+    if (m00 > m11 && m00 > m22) {
+        const float s = 2.0f * std::sqrt(1.0f + m00 - m11 - m22); // 4x
+        return Quatf(0.25f * s, (m01 + m10) / s, (m02 + m20) / s, (m21 - m12) / s);
+    }
+    if (m11 > m22) {
+        const float s = 2.0f * std::sqrt(1.0f + m11 - m00 - m22); // 4y
+        return Quatf((m01 + m10) / s, 0.25f * s, (m12 + m21) / s, (m02 - m20) / s);
+    }
+    const float s = 2.0f * std::sqrt(1.0f + m22 - m00 - m11); // 4z
+    return Quatf((m02 + m20) / s, (m12 + m21) / s, 0.25f * s, (m10 - m01) / s);
+}
+
+Quatf slerp(const Quatf& a, const Quatf& b, float t) {
+    float cosTheta = dot(a, b);
+    Vec4f end = b.v;
+    if (cosTheta < 0.0f) { // Shortest path
+        cosTheta = -cosTheta;
+        end = end * -1.0f;
+    }
+
+    // Nearly parallel: sin(theta) -> 0, nlerp is accurate there
+    if (cosTheta > 0.9995f) return Quatf(normalize(a.v + (end - a.v) * t));
+
+    const float theta = std::acos(cosTheta);
+    const float invSin = 1.0f / std::sin(theta);
+    return Quatf(a.v * (std::sin((1.0f - t) * theta) * invSin) + end * (std::sin(t * theta) * invSin));
+}
+
+Mat3f toMat3f(const Quatf& q) {
+    const float x = q.v.x, y = q.v.y, z = q.v.z, w = q.v.w;
+    const float xx = x * x, yy = y * y, zz = z * z;
+    const float xy = x * y, xz = x * z, yz = y * z;
+    const float wx = w * x, wy = w * y, wz = w * z;
+    return Mat3f({
+        1.0f - 2.0f * (yy + zz), 2.0f * (xy - wz),        2.0f * (xz + wy),
+        2.0f * (xy + wz),        1.0f - 2.0f * (xx + zz), 2.0f * (yz - wx),
+        2.0f * (xz - wy),        2.0f * (yz + wx),        1.0f - 2.0f * (xx + yy)
+    });
+}
+
+
+// ========================================================
+// --- TRANSFORM (TRS) ------------------------------------
+// ========================================================
+Mat4f Transform::toMat4f() const {
+    // [R * S | T]: the rotation columns scaled by the scale components
+    const Mat3f R = toMat3f(rotation);
+    Mat4f res = Mat4f::Identity();
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 3; ++c) res.data[r * 4 + c] = R.data[r * 3 + c] * scale.data[c];
+        res.data[r * 4 + 3] = translation.data[r];
+    }
+    return res;
+}
+
+}
+}
@@ -0,0 +1,148 @@
+#include "astro/math/batch.hpp"
+#include "astro/math/math.hpp"
+#include "astro_test.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+using namespace astro::math;
+
+// ========================================================
+// --- BATCH (SoA) ----------------------------------------
+// ========================================================
+TEST(BatchFloatOps) {
+    float raw[8] = {-3.0f, -1.5f, 0.0f, 1.0f, 2.0f, 4.0f, 9.0f, 16.0f};
+    Floatx8 a = Floatx8::load(raw);
+    Floatx8 b(2.0f);
+    for(int i = 0; i < 8; i++) ASSERT_EQ(a[i], raw[i]);
+
+    Floatx8 sum = a + b;
+    Floatx8 prod = a * b;
+    Floatx8 quot = a / 2.0f;
+    Floatx8 root = sqrt(max(a, Floatx8(0.0f)));
+    Floatx8 absolute = abs(a);
+    for(int i = 0; i < 8; i++) {
+        ASSERT_EQ(sum[i], raw[i] + 2.0f);
+        ASSERT_EQ(prod[i], raw[i] * 2.0f);
+        ASSERT_EQ(quot[i], raw[i] / 2.0f);
+        ASSERT_EQ(root[i], std::sqrt(std::max(raw[i], 0.0f)));
+        ASSERT_EQ(absolute[i], std::fabs(raw[i]));
+    }
+
+    // Masks and select
+    Maskx8 positive = a > 0.0f;
+    ASSERT_EQ(bits(positive), 0b11111000u);
+    ASSERT_TRUE(any(positive));
+    ASSERT_FALSE(all(positive));
+    ASSERT_TRUE(all(positive | ~positive));
+    ASSERT_TRUE(none(positive & ~positive));
+    Floatx8 sel = select(positive, a, Floatx8(-1.0f));
+    for(int i = 0; i < 8; i++) ASSERT_EQ(sel[i], raw[i] > 0.0f ? raw[i] : -1.0f);
+    return true;
+}
+
+TEST(BatchVectorOps) {
+    auto eq = [](float a, float b) { return std::fabs(a - b) < 1e-5f; };
+    Vec3f A[8];
+    Vec3f B[8];
+    for(int i = 0; i < 8; i++) {
+        A[i] = Vec3f(1.0f + i, 2.0f - i, 0.5f * i);
+        B[i] = Vec3f(-1.0f, 3.0f + i, 2.0f);
+    }
+    Vec3fx8 a = Vec3fx8::load(A);
+    Vec3fx8 b = Vec3fx8::load(B);
+
+    // Every lane matches the scalar Vector result
+    Vec3fx8 s = a + b;
+    Vec3fx8 d = a - b;
+    Vec3fx8 p = a * b;
+    Vec3fx8 c = cross(a, b);
+    Floatx8 dt = dot(a, b);
+    Floatx8 l = len(a);
+    Vec3fx8 n = normalize(a);
+    for(int i = 0; i < 8; i++) {
+        ASSERT_EQ(s.lane(i), A[i] + B[i]);
+        ASSERT_EQ(d.lane(i), A[i] - B[i]);
+        ASSERT_EQ(p.lane(i), A[i] * B[i]);
+        ASSERT_EQ(c.lane(i), cross(A[i], B[i]));
+        ASSERT_TRUE(eq(dt[i], dot(A[i], B[i])));
+        ASSERT_TRUE(eq(l[i], len(A[i])));
+        Vec3f ni = normalize(A[i]);
+        for(int k = 0; k < 3; k++) ASSERT_TRUE(eq(n.lane(i)[k], ni[k]));
+    }
+
+    // AoS round trip
+    Vec3f out[8];
+    s.store(out);
+    for(int i = 0; i < 8; i++) ASSERT_EQ(out[i], A[i] + B[i]);
+
+    // Select per lane
+    Vec3fx8 sel = select(a.x() > 4.0f, a, b);
+    for(int i = 0; i < 8; i++) ASSERT_EQ(sel.lane(i), (A[i].x > 4.0f) ? A[i] : B[i]);
+
+#if ASTRO_MATH_CHECKED
+    // Zero-length lanes cannot be normalized
+    Vec3fx8 z = a;
+    z.setLane(3, Vec3f(0.0f));
+    try {
+        normalize(z);
+        ASSERT_TRUE(false);
+    } catch (std::runtime_error &e) {
+        ASSERT_TRUE(true);
+    }
+#endif
+    return true;
+}
+
+TEST(BatchWidths) {
+    // 4 and 16 lanes, 2 and 4 components
+    Vec4fx4 a(Vec4f(1.0f, 2.0f, 3.0f, 4.0f));
+    Vec4fx4 b(Vec4f(0.0f, 1.0f, 0.0f, 0.0f));
+    Vec4fx4 c = cross(a, b);
+    for(int i = 0; i < 4; i++) ASSERT_EQ(c.lane(i), Vec4f(-3.0f, 0.0f, 1.0f, 0.0f));
+
+    Vec2fx16 u(0.0f);
+    for(int i = 0; i < 16; i++) u.setLane(i, Vec2f(float(i), 1.0f));
+    Floatx16 ud = dot(u, u);
+    for(int i = 0; i < 16; i++) ASSERT_EQ(ud[i], float(i * i + 1));
+    ASSERT_EQ(bits(u.x() >= 8.0f), 0xFF00u);
+    return true;
+}
+
+TEST(BatchSolve) {
+    // Diagonally dominant 4x4 systems in every lane, matches the scalar LU solve
+    Mat4fx8 A(0.0f);
+    Vec4fx8 b(0.0f);
+    for(int i = 0; i < 8; i++) {
+        Mat4f M(0.0f);
+        for(int r = 0; r < 4; r++)
+            for(int c = 0; c < 4; c++) M(r, c) = (r == c) ? 6.0f + i : std::sin(float(r * 4 + c + i));
+        A.setLane(i, M);
+        b.setLane(i, Vec4f(1.0f, float(i), -2.0f, 0.5f));
+    }
+    // Lane 2 needs a pivot swap, lane 5 is singular
+    Mat4f swapped = A.lane(2);
+    swapped(0, 0) = 0.0f;
+    A.setLane(2, swapped);
+    A.setLane(5, Mat4f(1.0f));
+
+    Vec4fx8 x;
+    const Maskx8 valid = solve(A, b, x);
+    ASSERT_EQ(bits(valid), 0b11011111u);
+    for(int i = 0; i < 8; i++) {
+        if (i == 5) continue;
+        const Vec4f expected = solve(A.lane(i), b.lane(i));
+        for(int c = 0; c < 4; c++) ASSERT_TRUE(std::fabs(x.lane(i)[c] - expected[c]) < 1e-5f);
+    }
+
+    // Singular lanes are the ones the scalar LU flags: relative tolerance, whatever the scale
+    Mat4f nearlySingular = Mat4f::Identity();
+    nearlySingular(3, 3) = 1e-9f;
+    A.setLane(0, Mat4f::Identity(1e-20f));     // Tiny but well conditioned
+    A.setLane(1, nearlySingular);               // Pivot 1e-9 > 1e-12 but below 4 * eps * 1
+    A.setLane(3, Mat4f(1e6f));                  // Large and singular
+    const Maskx8 scaled = solve(A, b, x);
+    for(int i = 0; i < 8; i++) ASSERT_EQ(bool(bits(scaled) & (1u << i)), !luDecompose(A.lane(i)).singular);
+    ASSERT_EQ(bits(scaled) & 0b1011u, 0b0001u);
+    return true;
+}
@@ -1,6 +1,9 @@
+#include "astro/math/expr.hpp"
+#include "astro/math/fast.hpp"
 #include "astro/math/math.hpp"
 #include "astro_test.hpp"
 
+#include <array>
 #include <cmath>
 #include <stdexcept>
 
@@ -166,12 +169,14 @@ TEST(VecDivision) {
     Vector<float, 16> b1(15.0);
     Vector<float, 16> b2(0.0);
     Vector<float, 16> b3(5.0);
+#if ASTRO_MATH_CHECKED
     try {
         ASSERT_EQ(b1 / b2, b3);
         ASSERT_TRUE(false);
     } catch (std::runtime_error &e) {
         ASSERT_TRUE(true);
     }
+#endif
 
     // Integer
     Vec2i c1(5);
@@ -183,6 +188,59 @@ TEST(VecDivision) {
     return false;
 }
 
+TEST(Vec4fSimd){
+    auto eq = [](float a, float b) { return std::fabs(a - b) < 1e-5f; };
+    Vec4f a(1.0f, 2.0f, 3.0f, 4.0f);
+    Vec4f b(5.0f, -6.0f, 7.0f, 0.5f);
+    ASSERT_EQ(alignof(Vec4f), 16);
+    ASSERT_EQ(sizeof(Vec4f), 16);
+
+    // Element wise and scalar operators
+    ASSERT_EQ(a + b, Vec4f(6.0f, -4.0f, 10.0f, 4.5f));
+    ASSERT_EQ(a - b, Vec4f(-4.0f, 8.0f, -4.0f, 3.5f));
+    ASSERT_EQ(a * b, Vec4f(5.0f, -12.0f, 21.0f, 2.0f));
+    ASSERT_EQ(a / b, Vec4f(0.2f, 2.0f / -6.0f, 3.0f / 7.0f, 8.0f));
+    ASSERT_EQ(a + 1.0f, Vec4f(2.0f, 3.0f, 4.0f, 5.0f));
+    ASSERT_EQ(a * 2.0f, Vec4f(2.0f, 4.0f, 6.0f, 8.0f));
+    ASSERT_EQ(a / 2.0f, Vec4f(0.5f, 1.0f, 1.5f, 2.0f));
+#if ASTRO_MATH_CHECKED
+    try {
+        ASSERT_EQ(a / Vec4f(1.0f, 1.0f, 0.0f, 1.0f), a);
+        ASSERT_TRUE(false);
+    } catch (std::runtime_error &e) {
+        ASSERT_TRUE(true);
+    }
+#endif
+
+    // Swizzle members still alias the register
+    Vec4f c = a;
+    c.xyz = Vec3f(9.0f, 8.0f, 7.0f);
+    ASSERT_EQ(c, Vec4f(9.0f, 8.0f, 7.0f, 4.0f));
+    c = 0.0f;
+    ASSERT_EQ(c, Vec4f(0.0f));
+
+    // Geometry
+    ASSERT_TRUE(eq(dot(a, b), 5.0f - 12.0f + 21.0f + 2.0f));
+    ASSERT_TRUE(eq(len(Vec4f(2.0f, 2.0f, 2.0f, 2.0f)), 4.0f));
+    Vec4f n = normalize(a);
+    ASSERT_TRUE(eq(len(n), 1.0f));
+    for(int i = 0; i < 4; i++) ASSERT_TRUE(eq(n[i], a[i] / std::sqrt(30.0f)));
+#if ASTRO_MATH_CHECKED
+    try {
+        normalize(Vec4f(0.0f));
+        ASSERT_TRUE(false);
+    } catch (std::runtime_error &e) {
+        ASSERT_TRUE(true);
+    }
+#endif
+
+    Vec3f expected = cross(a.xyz, b.xyz);
+    Vec4f x = cross(a, b);
+    for(int i = 0; i < 3; i++) ASSERT_TRUE(eq(x[i], expected[i]));
+    ASSERT_EQ(cross(Vec4f(1.0f, 0.0f, 0.0f, 0.0f), Vec4f(0.0f, 1.0f, 0.0f, 0.0f)), Vec4f(0.0f, 0.0f, 1.0f, 0.0f));
+    return true;
+}
+
 TEST(VecLen){
     Vector<float, 16> a1(15.0);
     Vec2i a2(3);
@@ -202,6 +260,36 @@ TEST(VecLen){
 // --- MATRIX ---------------------------------------------
 // ========================================================
 
+TEST(CheckedAccess){
+    Vec3f v(1.0f, 2.0f, 3.0f);
+    Mat4f M = Mat4f::Identity();
+    ASSERT_EQ(v.at(2), 3.0f);
+    ASSERT_EQ(M.at(3, 3), 1.0f);
+
+    // at() always checks
+    int thrown = 0;
+    try { v.at(3); } catch (std::out_of_range &e) { thrown++; }
+    try { M.at(4, 0); } catch (std::out_of_range &e) { thrown++; }
+    try { Matrix<int, 2, 3>(0).at(0, 3); } catch (std::out_of_range &e) { thrown++; }
+    ASSERT_EQ(thrown, 3);
+
+    // operator() only checks when ASTRO_MATH_CHECKED is on, and is noexcept otherwise
+    ASSERT_EQ(noexcept(M(0, 0)), !ASTRO_MATH_CHECKED);
+    ASSERT_EQ(noexcept(v(0)), !ASTRO_MATH_CHECKED);
+    ASSERT_TRUE(noexcept(v[0]));
+#if ASTRO_MATH_CHECKED
+    try {
+        M(0, 4);
+        ASSERT_TRUE(false);
+    } catch (std::out_of_range &e) {
+        ASSERT_TRUE(true);
+    }
+#else
+    ASSERT_TRUE(std::isinf((Vec3f(1.0f) / 0.0f).x)); // IEEE semantics without checks
+#endif
+    return true;
+}
+
 TEST(MatrixInitialization){
     Matrix<int, 3, 3> A2(5); // Const value initialization
     for(int j = 0; j < 3; j++){
@@ -333,6 +421,89 @@ TEST(MatrixMultiplication){
     return true;
 }
 
+TEST(Mat4fSimd){
+    auto eq = [](float a, float b) { return std::fabs(a - b) < 1e-4f; };
+    Mat4f A(0.0f);
+    Mat4f B(0.0f);
+    for(int i = 0; i < 16; i++) {
+        A.data[i] = 0.5f * i - 3.0f;
+        B.data[i] = (i % 5) - 1.5f * (i % 3);
+    }
+    ASSERT_EQ(alignof(Mat4f), 16);
+
+    // The generic templates (through views) are the reference
+    Matrix_View<float, 4, 4> Av(A);
+    Matrix_View<float, 4, 4> Bv(B);
+    Matrix<float, 4, 4> AB = A * B;
+    Matrix<float, 4, 4> AB_ref = Av * Bv;
+    for(int r = 0; r < 4; r++)
+        for(int c = 0; c < 4; c++) ASSERT_TRUE(eq(AB(r, c), AB_ref(r, c)));
+
+    Vec4f v(1.0f, -2.0f, 0.5f, 3.0f);
+    Vec4f Av_simd = A * v;
+    Vector<float, 4> Av_ref = Av * v;
+    for(int i = 0; i < 4; i++) ASSERT_TRUE(eq(Av_simd[i], Av_ref[i]));
+
+    Mat4f At = transpose(A);
+    for(int r = 0; r < 4; r++)
+        for(int c = 0; c < 4; c++) ASSERT_EQ(At(r, c), A(c, r));
+
+    // Copy keeps every element
+    Mat4f C(A);
+    ASSERT_EQ(C, A);
+    ASSERT_EQ(Mat4f::Identity() * A, A);
+    return true;
+}
+
+TEST(TransformInverses){
+    auto near = [](const Mat4f& A, const Mat4f& B) {
+        for (int i = 0; i < 16; i++) if (std::fabs(A.data[i] - B.data[i]) > 1e-4f) return false;
+        return true;
+    };
+
+    // Rigid: rotation around an arbitrary axis + translation
+    const float c = std::cos(0.7f), s = std::sin(0.7f);
+    Mat4f rigid({
+        c,    0.0f, s,    1.5f,
+        0.0f, 1.0f, 0.0f, -2.0f,
+        -s,   0.0f, c,    0.25f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    });
+    rigid = rigid * Mat4f({
+        1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, c,    -s,   0.0f,
+        0.0f, s,    c,    3.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    });
+    ASSERT_TRUE(near(inverseRigid(rigid), inverse(rigid)));
+    ASSERT_TRUE(near(rigid * inverseRigid(rigid), Mat4f::Identity()));
+
+    // Affine: non-uniform scale and shear + translation
+    Mat4f affine({
+        2.0f, 0.5f, 0.0f, 4.0f,
+        0.0f, 3.0f, 0.2f, -1.0f,
+        0.1f, 0.0f, 0.5f, 2.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    });
+    ASSERT_TRUE(near(inverseAffine(affine), inverse(affine)));
+    ASSERT_TRUE(near(inverse(affine, TransformType::Affine), inverse(affine)));
+    ASSERT_TRUE(near(inverse(rigid, TransformType::Rigid), inverse(rigid)));
+
+    // Normal matrix
+    Mat3f normalMatrix = inverseTranspose3x3(affine);
+    Mat4f reference = transpose(inverse(affine));
+    for (int r = 0; r < 3; r++)
+        for (int col = 0; col < 3; col++) ASSERT_TRUE(std::fabs(normalMatrix(r, col) - reference(r, col)) < 1e-4f);
+
+    // Singular linear part
+    try {
+        inverseAffine(Mat4f(0.0f));
+        ASSERT_TRUE(false);
+    } catch (std::runtime_error &e) {
+        ASSERT_TRUE(true);
+    }
+    return true;
+}
 
 TEST(MatrixProjection) {
 
@@ -389,6 +560,218 @@ TEST(MatrixProjection) {
     return true;
 }
 
+TEST(LUDecomposition){
+    // 5x5 system with a known solution, the first pivot forces a row swap
+    Matrix<double, 5, 5> A(0.0);
+    const double values[25] = {
+        0.0, 2.0, 1.0, -1.0, 3.0,
+        4.0, 1.0, 0.0, 2.0, -2.0,
+        1.0, -3.0, 5.0, 0.0, 1.0,
+        2.0, 0.0, -1.0, 6.0, 2.0,
+        -1.0, 2.0, 3.0, 1.0, 7.0
+    };
+    for (int i = 0; i < 25; i++) A.data[i] = values[i];
+    const Vector<double, 5> expected(std::initializer_list<double>{1.0, -2.0, 0.5, 3.0, -1.0});
+    const Vector<double, 5> b = A * expected;
+
+    const Vector<double, 5> x = solve(A, b);
+    for (int i = 0; i < 5; i++) ASSERT_TRUE(std::fabs(x[i] - expected[i]) < 1e-12);
+
+    // Inverse and determinant beyond 4x4
+    const Matrix<double, 5, 5> I = A * inverse(A);
+    for (int r = 0; r < 5; r++)
+        for (int c = 0; c < 5; c++) ASSERT_TRUE(std::fabs(I(r, c) - (r == c ? 1.0 : 0.0)) < 1e-12);
+    const double det = determinant(A);
+    ASSERT_TRUE(std::fabs(det * determinant(inverse(A)) - 1.0) < 1e-12);
+
+    // Matches the closed forms on 4x4
+    Mat4f B({
+        2.0f, -1.0f, 0.0f, 3.0f,
+        1.0f, 4.0f, -2.0f, 0.0f,
+        0.0f, 1.0f, 5.0f, -1.0f,
+        3.0f, 0.0f, 1.0f, 2.0f
+    });
+    ASSERT_TRUE(std::fabs(determinant(luDecompose(B)) - determinant(B)) < 1e-3f);
+
+    // Least squares: line fit through points on y = 2x + 1
+    Matrix<double, 6, 2> M(0.0);
+    Vector<double, 6> y(0.0);
+    for (int i = 0; i < 6; i++) {
+        M(i, 0) = i;
+        M(i, 1) = 1.0;
+        y[i] = 2.0 * i + 1.0;
+    }
+    const Vector<double, 2> line = solveLeastSquares(M, y);
+    ASSERT_TRUE(std::fabs(line[0] - 2.0) < 1e-9 && std::fabs(line[1] - 1.0) < 1e-9);
+
+    // Singular matrices
+    Matrix<double, 5, 5> S = A;
+    for (int c = 0; c < 5; c++) S(4, c) = S(0, c) + S(1, c);
+    ASSERT_TRUE(luDecompose(S).singular);
+    ASSERT_EQ(determinant(S), 0.0);
+    try {
+        solve(S, b);
+        ASSERT_TRUE(false);
+    } catch (std::runtime_error &e) {
+        ASSERT_TRUE(true);
+    }
+    return true;
+}
+
+// ========================================================
+// --- CONSTEXPR ------------------------------------------
+// ========================================================
+// Tables computed at compile time (stored in .rodata)
+static constexpr std::array<float, 256> srgbToLinear = [] {
+    std::array<float, 256> table{};
+    for (int i = 0; i < 256; i++) {
+        const double c = i / 255.0;
+        table[i] = static_cast<float>(c <= 0.04045 ? c / 12.92 : cx::pow((c + 0.055) / 1.055, 2.4));
+    }
+    return table;
+}();
+
+static constexpr Matrix<int, 4, 4> bayer4 = [] {
+    // Recursive Bayer construction: B(2n) = [4B + 0, 4B + 2; 4B + 3, 4B + 1]
+    Matrix<int, 4, 4> res(0);
+    const int b2[2][2] = {{0, 2}, {3, 1}};
+    for (int r = 0; r < 4; r++)
+        for (int c = 0; c < 4; c++) res(r, c) = 4 * b2[r % 2][c % 2] + b2[r / 2][c / 2];
+    return res;
+}();
+
+TEST(ConstexprMath){
+    // Vectors
+    constexpr Vec3f a(1.0f, 2.0f, 3.0f);
+    constexpr Vec3f b = a * 2.0f + Vec3f(1.0f);
+    static_assert(b == Vec3f(3.0f, 5.0f, 7.0f));
+    static_assert(dot(a, b) == 34.0f);
+    static_assert(cross(Vec3f(1.0f, 0.0f, 0.0f), Vec3f(0.0f, 1.0f, 0.0f)) == Vec3f(0.0f, 0.0f, 1.0f));
+    static_assert(len(Vec3f(3.0f, 4.0f, 0.0f)) == 5.0f);
+    constexpr Vec4f v = Vec4f(a, 1.0f) * Vec4f(2.0f) - 1.0f;
+    static_assert(v == Vec4f(1.0f, 3.0f, 5.0f, 1.0f));
+    static_assert(Vec2i{4, 2} + Vec2i(1) == Vec2i(5, 3));
+
+    // Matrices
+    constexpr Mat4f T({
+        1.0f, 0.0f, 0.0f, 2.0f,
+        0.0f, 1.0f, 0.0f, 3.0f,
+        0.0f, 0.0f, 1.0f, 4.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    });
+    static_assert(T * Mat4f::Identity() == T);
+    static_assert(transpose(transpose(T)) == T);
+    static_assert((T * Vec4f(1.0f, 1.0f, 1.0f, 1.0f)) == Vec4f(3.0f, 4.0f, 5.0f, 1.0f));
+    static_assert(determinant(Mat3f::Identity(2.0f)) == 8.0f);
+    static_assert(inverse(Matrix<double, 2, 2>({4.0, 7.0, 2.0, 6.0}))(0, 0) == 0.6);
+    constexpr Mat4f proj = perspective(PI / 2.0f, 2.0f, 0.1f, 100.0f);
+    static_assert(proj(3, 2) == -1.0f);
+    constexpr Mat4f view = lookAt(Vec3f(0.0f, 0.0f, 5.0f), Vec3f(0.0f), Vec3f(0.0f, 1.0f, 0.0f));
+    static_assert(view(2, 3) == -5.0f);
+
+    // Compile time results match the run time ones
+    const float fov = PI / 2.0f;
+    const Mat4f runtimeProj = perspective(fov, 2.0f, 0.1f, 100.0f);
+    for (int i = 0; i < 16; i++) ASSERT_TRUE(std::fabs(runtimeProj.data[i] - proj.data[i]) <= 1e-6f * std::fabs(proj.data[i]));
+    ASSERT_EQ(lookAt(Vec3f(0.0f, 0.0f, 5.0f), Vec3f(0.0f), Vec3f(0.0f, 1.0f, 0.0f)), view);
+
+    // Scalar functions
+    constexpr double sinCx = cx::sin(1.0), cosCx = cx::cos(-7.5), tanCx = cx::tan(0.3);
+    constexpr double expCx = cx::exp(-3.7), logCx = cx::log(1234.5), powCx = cx::pow(0.3, 2.2), sqrtCx = cx::sqrt(2.0);
+    ASSERT_TRUE(std::fabs(sinCx - std::sin(1.0)) < 1e-15);
+    ASSERT_TRUE(std::fabs(cosCx - std::cos(-7.5)) < 1e-15);
+    ASSERT_TRUE(std::fabs(tanCx - std::tan(0.3)) < 1e-15);
+    ASSERT_TRUE(std::fabs(expCx / std::exp(-3.7) - 1.0) < 1e-15);
+    ASSERT_TRUE(std::fabs(logCx / std::log(1234.5) - 1.0) < 1e-15);
+    ASSERT_TRUE(std::fabs(powCx / std::pow(0.3, 2.2) - 1.0) < 1e-14);
+    ASSERT_EQ(sqrtCx, std::sqrt(2.0));
+    static_assert(cx::pow(2.0, 10.0) == 1024.0);
+
+    // Tables
+    for (int i = 0; i < 256; i++) {
+        const double c = i / 255.0;
+        const float expected = static_cast<float>(c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4));
+        ASSERT_TRUE(std::fabs(srgbToLinear[i] - expected) <= 1e-7f * expected);
+    }
+    static_assert(bayer4(0, 0) == 0 && bayer4(0, 1) == 8 && bayer4(1, 1) == 4 && bayer4(3, 3) == 5);
+    return true;
+}
+
+// ========================================================
+// --- EXPRESSION TEMPLATES -------------------------------
+// ========================================================
+TEST(ExpressionTemplates) {
+    using expr::lazy;
+    const Vec3f a(1.0f, 2.0f, 3.0f);
+    const Vec3f b(-4.0f, 0.5f, 2.0f);
+    const Vec3f c(0.25f, -1.0f, 8.0f);
+    const float alpha = 0.2f, beta = 0.3f, gamma = 0.5f, w = 1.5f;
+
+    // Same result as the eager operators
+    Vec3f fused = (lazy(a) * alpha + lazy(b) * beta + lazy(c) * gamma) * w;
+    Vec3f eager = (a * alpha + b * beta + c * gamma) * w;
+    ASSERT_EQ(fused, eager);
+
+    // Plain vectors mix with expressions, scalars on either side
+    Vec3f mixed = lazy(a) + b * c - 2.0f * lazy(a) / 4.0f;
+    Vec3f expected = a + (b * c) - (a * 2.0f) / 4.0f;
+    for (int i = 0; i < 3; i++) ASSERT_TRUE(std::abs(mixed[i] - expected[i]) < 1e-6f);
+
+    // Explicit evaluation and fused dot product
+    Vec2f uv = expr::eval(lazy(Vec2f(1.0f, 2.0f)) + 1.0f);
+    ASSERT_EQ(uv, Vec2f(2.0f, 3.0f));
+    ASSERT_EQ(expr::dot(lazy(a) + b, c), dot(a + b, c));
+
+    // Vec4f (SIMD specialization) is a valid target
+    const Vec4f p(1.0f, 2.0f, 3.0f, 4.0f);
+    Vec4f q = lazy(p) * 2.0f - p;
+    ASSERT_EQ(q, p);
+    return true;
+}
+
+// ========================================================
+// --- FAST APPROXIMATIONS --------------------------------
+// ========================================================
+TEST(FastMath) {
+    // Documented max errors (see fast.hpp), sampled over the domains
+    auto relErr = [](double got, double expected) { return std::abs(got - expected) / std::abs(expected); };
+    for (float x = 1e-30f; x < 1e30f; x *= 1.0137f) {
+        ASSERT_TRUE(relErr(fast::rsqrt(x), 1.0 / std::sqrt((double)x)) < 4e-7);
+        ASSERT_TRUE(relErr(fast::rcp(x), 1.0 / (double)x) < 3e-7);
+        ASSERT_TRUE(relErr(fast::rcp(-x), -1.0 / (double)x) < 3e-7);
+        ASSERT_TRUE(relErr(fast::sqrt(x), std::sqrt((double)x)) < 4e-7);
+        const double l = std::log2((double)x);
+        const double logErr = (std::abs(l) < 1.0) ? std::abs(fast::log2(x) - l) / 3e-7 : relErr(fast::log2(x), l) / 2e-7;
+        ASSERT_TRUE(logErr < 1.0);
+    }
+    for (float x = -125.5f; x < 127.5f; x += 0.0137f) {
+        ASSERT_TRUE(relErr(fast::exp2(x), std::exp2((double)x)) < 4e-7);
+    }
+    for (float x = 1e-3f; x <= 1.0f; x += 0.0013f) {
+        for (float y = 1.0f; y <= 256.0f; y *= 1.3f) {
+            const double expected = std::pow((double)x, (double)y);
+            if (expected < 1e-37) continue; // Not a normal float
+            ASSERT_TRUE(relErr(fast::pow(x, y), expected) < 3e-5);
+        }
+    }
+
+    // Edge cases
+    ASSERT_EQ(fast::sqrt(0.0f), 0.0f);
+    ASSERT_EQ(fast::pow(0.0f, 8.0f), 0.0f);
+    ASSERT_EQ(fast::exp2(-200.0f), 0.0f);
+    ASSERT_TRUE(std::isinf(fast::exp2(200.0f)));
+    ASSERT_TRUE(std::isinf(fast::log2(0.0f)));
+    ASSERT_TRUE(relErr(fast::exp2(127.4f), std::exp2((double)127.4f)) < 4e-7);
+
+    // Vectors
+    const Vec3f v(3.0f, -4.0f, 12.0f);
+    const Vec3f n = fast::normalize(v);
+    const Vec3f expected = normalize(v);
+    for (int i = 0; i < 3; i++) ASSERT_TRUE(relErr(n[i], expected[i]) < 5e-7);
+    ASSERT_TRUE(relErr(fast::len(v), 13.0) < 4e-7);
+    return true;
+}
+
 int main(){
     bool all_success = run_all_tests();
     return !all_success;
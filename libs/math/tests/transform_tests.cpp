@@ -0,0 +1,108 @@
+#include "astro/math/math.hpp"
+#include "astro/math/transform.hpp"
+#include "astro_test.hpp"
+
+#include <cmath>
+
+using namespace astro::math;
+
+static bool near(float a, float b, float eps = 1e-5f) { return std::abs(a - b) < eps; }
+static bool near(const Vec3f& a, const Vec3f& b, float eps = 1e-5f) {
+    return near(a.x, b.x, eps) && near(a.y, b.y, eps) && near(a.z, b.z, eps);
+}
+static bool near(const Mat4f& A, const Mat4f& B, float eps = 1e-5f) {
+    for (int i = 0; i < 16; i++) if (!near(A.data[i], B.data[i], eps)) return false;
+    return true;
+}
+
+// ========================================================
+// --- QUATERNION -----------------------------------------
+// ========================================================
+TEST(QuaternionRotation) {
+    const Quatf rz = Quatf::fromAxisAngle(Vec3f(0.0f, 0.0f, 1.0f), PI / 2.0f);
+    ASSERT_TRUE(near(rotate(rz, Vec3f(1.0f, 0.0f, 0.0f)), Vec3f(0.0f, 1.0f, 0.0f)));
+
+    // Product composes rotations (b first, then a) and matches the matrices
+    const Quatf a = Quatf::fromAxisAngle(normalize(Vec3f(1.0f, 2.0f, 3.0f)), 0.7f);
+    const Quatf b = Quatf::fromAxisAngle(normalize(Vec3f(-2.0f, 0.5f, 1.0f)), 1.9f);
+    const Vec3f p(0.3f, -1.2f, 2.5f);
+    ASSERT_TRUE(near(rotate(a * b, p), rotate(a, rotate(b, p))));
+    const Mat3f ab = toMat3f(a * b);
+    const Mat3f expected = toMat3f(a) * toMat3f(b);
+    for (int i = 0; i < 9; i++) ASSERT_TRUE(near(ab.data[i], expected.data[i]));
+    const Vec3f viaMatrix = toMat3f(a) * p;
+    ASSERT_TRUE(near(viaMatrix, rotate(a, p)));
+
+    // Inverse
+    ASSERT_TRUE(near(rotate(conjugate(a), rotate(a, p)), p));
+    ASSERT_TRUE(near(rotate(inverse(a), rotate(a, p)), p));
+
+    // Basis round trip
+    const Mat3f R = toMat3f(b);
+    const Quatf fromR = Quatf::fromBasis(Vec3f(R(0, 0), R(1, 0), R(2, 0)), Vec3f(R(0, 1), R(1, 1), R(2, 1)), Vec3f(R(0, 2), R(1, 2), R(2, 2)));
+    ASSERT_TRUE(near(std::abs(dot(fromR, b)), 1.0f)); // q and -q are the same rotation
+    return true;
+}
+
+TEST(QuaternionInterpolation) {
+    const Vec3f axis(0.0f, 1.0f, 0.0f);
+    const Quatf a = Quatf::fromAxisAngle(axis, 0.2f);
+    const Quatf b = Quatf::fromAxisAngle(axis, 1.4f);
+
+    // Slerp has constant angular speed
+    for (float t = 0.0f; t <= 1.0f; t += 0.125f) {
+        const Quatf s = slerp(a, b, t);
+        const Quatf expected = Quatf::fromAxisAngle(axis, 0.2f + 1.2f * t);
+        ASSERT_TRUE(near(std::abs(dot(s, expected)), 1.0f));
+    }
+
+    // Nlerp matches at the ends and stays normalized, both take the shortest path
+    ASSERT_TRUE(near(std::abs(dot(nlerp(a, b, 1.0f), b)), 1.0f));
+    ASSERT_TRUE(near(dot(nlerp(a, b, 0.5f), nlerp(a, b, 0.5f)), 1.0f));
+    const Quatf negB(b.v * -1.0f);
+    ASSERT_TRUE(near(std::abs(dot(slerp(a, negB, 0.5f), slerp(a, b, 0.5f))), 1.0f));
+    ASSERT_TRUE(near(std::abs(dot(nlerp(a, negB, 0.5f), nlerp(a, b, 0.5f))), 1.0f));
+    return true;
+}
+
+// ========================================================
+// --- TRANSFORM (TRS) ------------------------------------
+// ========================================================
+TEST(TransformTRS) {
+    const Transform parent(Vec3f(1.0f, 2.0f, 3.0f), Quatf::fromAxisAngle(normalize(Vec3f(1.0f, 1.0f, 0.0f)), 0.9f), Vec3f(2.0f));
+    const Transform child(Vec3f(-0.5f, 0.0f, 4.0f), Quatf::fromAxisAngle(Vec3f(0.0f, 0.0f, 1.0f), -0.4f), Vec3f(1.0f, 0.5f, 3.0f));
+    const Vec3f p(0.7f, -0.2f, 1.1f);
+
+    // Matrix conversion
+    const Vec4f viaMatrix = parent.matrix() * Vec4f(p, 1.0f);
+    ASSERT_TRUE(near(viaMatrix.xyz, parent.transformPoint(p)));
+
+    // Composition matches the matrix product (uniform parent scale)
+    const Transform composed = parent * child;
+    ASSERT_TRUE(near(composed.matrix(), parent.matrix() * child.matrix(), 1e-4f));
+    ASSERT_TRUE(near(composed.transformPoint(p), parent.transformPoint(child.transformPoint(p)), 1e-4f));
+
+    // Inverse
+    const Transform inv = inverse(parent);
+    ASSERT_TRUE(near(inv.transformPoint(parent.transformPoint(p)), p));
+    ASSERT_TRUE(near((parent * inv).matrix(), Mat4f::Identity()));
+    ASSERT_TRUE(near(inverse(Transform(Vec3f(1.0f, 0.0f, 0.0f), child.getRotation())).matrix(),
+                     inverse(Transform(Vec3f(1.0f, 0.0f, 0.0f), child.getRotation()).matrix())));
+
+    // Lazy matrix follows the setters
+    Transform t;
+    ASSERT_TRUE(near(t.matrix(), Mat4f::Identity()));
+    ASSERT_TRUE(t.type() == TransformType::Rigid);
+    t.setTranslation(Vec3f(5.0f, 0.0f, 0.0f));
+    ASSERT_EQ(t.matrix()(0, 3), 5.0f);
+    t.setScale(Vec3f(2.0f));
+    ASSERT_EQ(t.matrix()(1, 1), 2.0f);
+    ASSERT_TRUE(t.type() == TransformType::Affine);
+
+    // Interpolation
+    const Transform mid = interpolate(Transform(), parent, 0.5f);
+    ASSERT_TRUE(near(mid.getTranslation(), Vec3f(0.5f, 1.0f, 1.5f)));
+    ASSERT_TRUE(near(mid.getScale(), Vec3f(1.5f)));
+    ASSERT_TRUE(near(std::abs(dot(mid.getRotation(), slerp(Quatf::Identity(), parent.getRotation(), 0.5f))), 1.0f));
+    return true;
+}
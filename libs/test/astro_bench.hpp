@@ -0,0 +1,58 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Keeps the compiler from optimizing a benchmarked value away
+template<typename T>
+inline void doNotOptimize(const T& value){
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// The benchmark function runs 'iterations' operations and returns how many it did
+struct Benchmark;
+std::vector<Benchmark>& benchmarks();
+struct Benchmark {
+    std::string name;
+    std::function<size_t(size_t)> func;
+    Benchmark(const std::string &name, const std::function<size_t(size_t)> &func)
+        : name(name), func(func) {
+      benchmarks().push_back(*this);
+    };
+};
+inline std::vector<Benchmark>& benchmarks(){
+    static std::vector<Benchmark> instance;
+    return instance;
+};
+
+#define BENCHMARK(name) \
+    size_t bench_func_##name(size_t iterations); \
+    static Benchmark bench_##name(#name, bench_func_##name); \
+    size_t bench_func_##name(size_t iterations) \
+
+/**
+ * @brief Runs every benchmark, doubling the iterations until a run takes at least 'minMs'
+ * and prints the time per operation
+ */
+inline void run_all_benchmarks(double minMs = 200.0){
+    using Clock = std::chrono::steady_clock;
+    for(const auto& bench: benchmarks()){
+        bench.func(1); // Warm up
+        size_t iterations = 1;
+        double elapsedMs = 0.0;
+        size_t ops = 0;
+        while(elapsedMs < minMs){
+            iterations *= 2;
+            const auto start = Clock::now();
+            ops = bench.func(iterations);
+            elapsedMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        }
+        std::cout << std::left << std::setw(40) << bench.name << std::right << std::setw(12) << std::fixed << std::setprecision(2)
+                  << (elapsedMs * 1e6 / static_cast<double>(ops)) << " ns/op\n";
+    }
+}